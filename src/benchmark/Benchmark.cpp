@@ -0,0 +1,359 @@
+#include "Benchmark.h"
+#include "../profiling/AllocationTracker.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Largest batch of operations timed in one sample
+    const int MAXIMUM_BATCH_SIZE = 10000000;
+
+    // Batches stop growing once they take this many times the minimum sample time on the wall clock.
+    // This keeps benchmarks that spend most of their time untimed (e.g. playing out a round) from running for minutes.
+    const int MAXIMUM_WALL_TIME_FACTOR = 10;
+
+    // Escape a string so that it can be written as a JSON string literal
+    std::string escapeJson(const std::string &text)
+    {
+        std::string escaped;
+        for (const auto &character : text)
+        {
+            if (character == '"' || character == '\\')
+            {
+                escaped += '\\';
+            }
+            escaped += character;
+        }
+
+        return escaped;
+    }
+}
+
+/*
+===================================
+ Implementation for BenchmarkResult
+===================================
+ */
+
+std::ostream &operator<<(std::ostream &output, const BenchmarkResult &result)
+{
+    output << "[Benchmark] " << result.name << ": " << result.mean << " ns/op (+/- " << result.standardDeviation << "), ";
+    output << result.allocationsPerOperation << " allocations/op";
+    if (result.hardwareCounters)
+    {
+        output << ", " << result.cyclesPerOperation << " cycles/op, " << result.instructionsPerOperation << " instructions/op";
+    }
+    return output;
+}
+
+
+// Initialize static members
+bool Benchmark::timing_ = false;
+std::chrono::steady_clock::time_point Benchmark::timerStart_;
+std::chrono::nanoseconds Benchmark::elapsed_(0);
+uint64_t Benchmark::allocationsAtStart_ = 0;
+uint64_t Benchmark::allocations_ = 0;
+uint64_t Benchmark::bytesAtStart_ = 0;
+uint64_t Benchmark::bytes_ = 0;
+PerfCounterValues Benchmark::hardwareAtStart_ = { 0, 0, 0, 0 };
+PerfCounterValues Benchmark::hardware_ = { 0, 0, 0, 0 };
+
+
+/*
+===================================
+ Implementation for Benchmark class
+===================================
+ */
+
+// Constructors
+// `setup` prepares the state for a batch of operations and `teardown` cleans it up. Neither of them is timed.
+// `operation` is called with the index of the operation within the batch.
+Benchmark::Benchmark(std::string name, std::function<void(int)> operation) : Benchmark(name, nullptr, operation, nullptr) {}
+
+Benchmark::Benchmark(std::string name, std::function<void(int)> setup, std::function<void(int)> operation, std::function<void()> teardown)
+    : name_(name), setup_(setup), operation_(operation), teardown_(teardown) {}
+
+Benchmark::Benchmark(const Benchmark &benchmark)
+    : name_(benchmark.name_), setup_(benchmark.setup_), operation_(benchmark.operation_), teardown_(benchmark.teardown_) {}
+
+// Operator overloading
+const Benchmark &Benchmark::operator=(const Benchmark &benchmark)
+{
+    if (this != &benchmark)
+    {
+        name_ = benchmark.name_;
+        setup_ = benchmark.setup_;
+        operation_ = benchmark.operation_;
+        teardown_ = benchmark.teardown_;
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const Benchmark &benchmark)
+{
+    output << "[Benchmark] " << benchmark.name_;
+    return output;
+}
+
+// Getters
+std::string Benchmark::getName() const
+{
+    return name_;
+}
+
+// Stop the timer (and the allocation and hardware counters) of the running benchmark.
+// Operations call this around work that should not be measured, such as restoring the game state.
+void Benchmark::pauseTiming()
+{
+    if (timing_)
+    {
+        elapsed_ += std::chrono::steady_clock::now() - timerStart_;
+        PerfCounterValues hardware = PerfCounters::read() - hardwareAtStart_;
+        hardware_.cycles += hardware.cycles;
+        hardware_.instructions += hardware.instructions;
+        hardware_.cacheMisses += hardware.cacheMisses;
+        hardware_.branchMisses += hardware.branchMisses;
+        allocations_ += AllocationTracker::getAllocationCount() - allocationsAtStart_;
+        bytes_ += AllocationTracker::getBytesAllocated() - bytesAtStart_;
+        timing_ = false;
+    }
+}
+
+void Benchmark::resumeTiming()
+{
+    if (!timing_)
+    {
+        timing_ = true;
+        allocationsAtStart_ = AllocationTracker::getAllocationCount();
+        bytesAtStart_ = AllocationTracker::getBytesAllocated();
+        hardwareAtStart_ = PerfCounters::read();
+        timerStart_ = std::chrono::steady_clock::now();
+    }
+}
+
+// Run a batch of operations and return the time spent in them. `wallTime` is set to the time taken by the whole batch.
+std::chrono::nanoseconds Benchmark::runBatch_(int batchSize, std::chrono::nanoseconds &wallTime) const
+{
+    auto start = std::chrono::steady_clock::now();
+    if (setup_)
+    {
+        setup_(batchSize);
+    }
+
+    elapsed_ = std::chrono::nanoseconds(0);
+    allocations_ = 0;
+    bytes_ = 0;
+    hardware_ = { 0, 0, 0, 0 };
+
+    resumeTiming();
+    for (int i = 0; i < batchSize; i++)
+    {
+        operation_(i);
+    }
+    pauseTiming();
+
+    if (teardown_)
+    {
+        teardown_();
+    }
+
+    wallTime = std::chrono::steady_clock::now() - start;
+    return elapsed_;
+}
+
+// Run the benchmark. The batch size is first grown until a batch takes at least `minimumSampleTime`
+// (or the wall clock limit above is reached), then `samples` batches of that size are timed.
+BenchmarkResult Benchmark::run(int samples, std::chrono::nanoseconds minimumSampleTime) const
+{
+    int batchSize = 1;
+    std::chrono::nanoseconds wallTime;
+    std::chrono::nanoseconds batchTime = runBatch_(batchSize, wallTime);
+    while (batchTime < minimumSampleTime && wallTime < MAXIMUM_WALL_TIME_FACTOR * minimumSampleTime && batchSize < MAXIMUM_BATCH_SIZE)
+    {
+        // Aim a bit past the minimum, but never grow more than 100x at once in case the first batches were noisy,
+        // nor past the wall clock limit
+        double scale = batchTime.count() > 0 ? 1.2 * minimumSampleTime.count() / batchTime.count() : 100.0;
+        double wallTimeScale = static_cast<double>(MAXIMUM_WALL_TIME_FACTOR * minimumSampleTime.count()) / std::max<long long>(wallTime.count(), 1);
+        scale = std::min({ std::max(scale, 2.0), wallTimeScale, 100.0 });
+        if (scale < 1.5)
+        {
+            break;
+        }
+        batchSize = static_cast<int>(std::min<double>(batchSize * scale, MAXIMUM_BATCH_SIZE));
+        batchTime = runBatch_(batchSize, wallTime);
+    }
+
+    std::vector<double> timesPerOperation;
+    uint64_t totalAllocations = 0;
+    uint64_t totalBytes = 0;
+    PerfCounterValues totalHardware = { 0, 0, 0, 0 };
+    for (int sample = 0; sample < samples; sample++)
+    {
+        batchTime = runBatch_(batchSize, wallTime);
+        timesPerOperation.push_back(static_cast<double>(batchTime.count()) / batchSize);
+        totalAllocations += allocations_;
+        totalBytes += bytes_;
+        totalHardware.cycles += hardware_.cycles;
+        totalHardware.instructions += hardware_.instructions;
+        totalHardware.cacheMisses += hardware_.cacheMisses;
+        totalHardware.branchMisses += hardware_.branchMisses;
+    }
+
+    BenchmarkResult result;
+    result.name = name_;
+    result.samples = samples;
+    result.operationsPerSample = batchSize;
+
+    double sum = 0;
+    for (const auto &time : timesPerOperation)
+    {
+        sum += time;
+    }
+    result.mean = sum / samples;
+
+    double squaredDeviations = 0;
+    for (const auto &time : timesPerOperation)
+    {
+        squaredDeviations += (time - result.mean) * (time - result.mean);
+    }
+    result.variance = samples > 1 ? squaredDeviations / (samples - 1) : 0;
+    result.standardDeviation = sqrt(result.variance);
+
+    sort(timesPerOperation.begin(), timesPerOperation.end());
+    result.minimum = timesPerOperation.front();
+    result.maximum = timesPerOperation.back();
+    result.median = samples % 2 == 1
+        ? timesPerOperation.at(samples / 2)
+        : (timesPerOperation.at(samples / 2 - 1) + timesPerOperation.at(samples / 2)) / 2;
+
+    double totalOperations = static_cast<double>(batchSize) * samples;
+    result.allocationsPerOperation = totalAllocations / totalOperations;
+    result.bytesAllocatedPerOperation = totalBytes / totalOperations;
+    result.hardwareCounters = PerfCounters::isEnabled();
+    result.cyclesPerOperation = totalHardware.cycles / totalOperations;
+    result.instructionsPerOperation = totalHardware.instructions / totalOperations;
+    result.cacheMissesPerOperation = totalHardware.cacheMisses / totalOperations;
+    result.branchMissesPerOperation = totalHardware.branchMisses / totalOperations;
+
+    return result;
+}
+
+
+/*
+===================================
+ Implementation for BenchmarkSuite class
+===================================
+ */
+
+// Constructors
+BenchmarkSuite::BenchmarkSuite() : samples_(10), minimumSampleTime_(std::chrono::milliseconds(5)) {}
+
+BenchmarkSuite::BenchmarkSuite(const BenchmarkSuite &suite)
+    : filter_(suite.filter_), samples_(suite.samples_), minimumSampleTime_(suite.minimumSampleTime_), benchmarks_(suite.benchmarks_), results_(suite.results_) {}
+
+// Operator overloading
+const BenchmarkSuite &BenchmarkSuite::operator=(const BenchmarkSuite &suite)
+{
+    if (this != &suite)
+    {
+        filter_ = suite.filter_;
+        samples_ = suite.samples_;
+        minimumSampleTime_ = suite.minimumSampleTime_;
+        benchmarks_ = suite.benchmarks_;
+        results_ = suite.results_;
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const BenchmarkSuite &suite)
+{
+    output << "[BenchmarkSuite] " << suite.benchmarks_.size() << " benchmarks, " << suite.results_.size() << " results";
+    return output;
+}
+
+// Setters
+// Only benchmarks whose name contains `filter` are run.
+void BenchmarkSuite::setFilter(std::string filter)
+{
+    filter_ = filter;
+}
+
+void BenchmarkSuite::setSamples(int samples)
+{
+    if (samples < 1)
+    {
+        throw "A benchmark needs at least one sample.";
+    }
+    samples_ = samples;
+}
+
+void BenchmarkSuite::setMinimumSampleTime(std::chrono::nanoseconds time)
+{
+    minimumSampleTime_ = time;
+}
+
+// Add a benchmark to the suite
+void BenchmarkSuite::add(Benchmark benchmark)
+{
+    benchmarks_.push_back(benchmark);
+}
+
+// Run every benchmark matching the filter, reporting each result to `progress` as it completes.
+std::vector<BenchmarkResult> BenchmarkSuite::run(std::ostream &progress)
+{
+    results_.clear();
+    for (const auto &benchmark : benchmarks_)
+    {
+        if (benchmark.getName().find(filter_) == std::string::npos)
+        {
+            continue;
+        }
+
+        results_.push_back(benchmark.run(samples_, minimumSampleTime_));
+        progress << results_.back() << std::endl;
+    }
+
+    return results_;
+}
+
+// Write the results of the last run as JSON.
+void BenchmarkSuite::writeJson(std::ostream &output) const
+{
+    output << "{\n";
+    output << "  \"samples\": " << samples_ << ",\n";
+    output << "  \"minimum_sample_time_ns\": " << minimumSampleTime_.count() << ",\n";
+    output << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results_.size(); i++)
+    {
+        const BenchmarkResult &result = results_.at(i);
+        output << (i == 0 ? "\n" : ",\n");
+        output << "    {\n";
+        output << "      \"name\": \"" << escapeJson(result.name) << "\",\n";
+        output << "      \"samples\": " << result.samples << ",\n";
+        output << "      \"operations_per_sample\": " << result.operationsPerSample << ",\n";
+        output << "      \"ns_per_op\": " << result.mean << ",\n";
+        output << "      \"ns_per_op_min\": " << result.minimum << ",\n";
+        output << "      \"ns_per_op_median\": " << result.median << ",\n";
+        output << "      \"ns_per_op_max\": " << result.maximum << ",\n";
+        output << "      \"ns_per_op_variance\": " << result.variance << ",\n";
+        output << "      \"ns_per_op_stddev\": " << result.standardDeviation << ",\n";
+        output << "      \"allocations_per_op\": " << result.allocationsPerOperation << ",\n";
+        output << "      \"bytes_allocated_per_op\": " << result.bytesAllocatedPerOperation;
+        if (result.hardwareCounters)
+        {
+            double instructionsPerCycle = result.cyclesPerOperation == 0 ? 0 : result.instructionsPerOperation / result.cyclesPerOperation;
+            output << ",\n";
+            output << "      \"cycles_per_op\": " << result.cyclesPerOperation << ",\n";
+            output << "      \"instructions_per_op\": " << result.instructionsPerOperation << ",\n";
+            output << "      \"ipc\": " << instructionsPerCycle << ",\n";
+            output << "      \"cache_misses_per_op\": " << result.cacheMissesPerOperation << ",\n";
+            output << "      \"branch_misses_per_op\": " << result.branchMissesPerOperation;
+        }
+        output << "\n";
+        output << "    }";
+    }
+
+    output << "\n  ]\n";
+    output << "}" << std::endl;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../profiling/PerfCounters.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Statistics collected for a single benchmark. Times are in nanoseconds per operation.
+struct BenchmarkResult
+{
+    std::string name;
+    int samples;
+    long long operationsPerSample;
+    double mean;
+    double minimum;
+    double median;
+    double maximum;
+    double variance;
+    double standardDeviation;
+    double allocationsPerOperation;
+    double bytesAllocatedPerOperation;
+    bool hardwareCounters;
+    double cyclesPerOperation;
+    double instructionsPerOperation;
+    double cacheMissesPerOperation;
+    double branchMissesPerOperation;
+};
+
+std::ostream &operator<<(std::ostream &output, const BenchmarkResult &result);
+
+
+class Benchmark
+{
+public:
+    Benchmark(std::string name, std::function<void(int)> operation);
+    Benchmark(std::string name, std::function<void(int)> setup, std::function<void(int)> operation, std::function<void()> teardown);
+    Benchmark(const Benchmark &benchmark);
+    const Benchmark &operator=(const Benchmark &benchmark);
+    friend std::ostream &operator<<(std::ostream &output, const Benchmark &benchmark);
+    std::string getName() const;
+    BenchmarkResult run(int samples, std::chrono::nanoseconds minimumSampleTime) const;
+    static void pauseTiming();
+    static void resumeTiming();
+
+private:
+    std::string name_;
+    std::function<void(int)> setup_;
+    std::function<void(int)> operation_;
+    std::function<void()> teardown_;
+    static bool timing_;
+    static std::chrono::steady_clock::time_point timerStart_;
+    static std::chrono::nanoseconds elapsed_;
+    static uint64_t allocationsAtStart_;
+    static uint64_t allocations_;
+    static uint64_t bytesAtStart_;
+    static uint64_t bytes_;
+    static PerfCounterValues hardwareAtStart_;
+    static PerfCounterValues hardware_;
+    std::chrono::nanoseconds runBatch_(int batchSize, std::chrono::nanoseconds &wallTime) const;
+};
+
+
+class BenchmarkSuite
+{
+public:
+    BenchmarkSuite();
+    BenchmarkSuite(const BenchmarkSuite &suite);
+    const BenchmarkSuite &operator=(const BenchmarkSuite &suite);
+    friend std::ostream &operator<<(std::ostream &output, const BenchmarkSuite &suite);
+    void setFilter(std::string filter);
+    void setSamples(int samples);
+    void setMinimumSampleTime(std::chrono::nanoseconds time);
+    void add(Benchmark benchmark);
+    std::vector<BenchmarkResult> run(std::ostream &progress);
+    void writeJson(std::ostream &output) const;
+
+private:
+    std::string filter_;
+    int samples_;
+    std::chrono::nanoseconds minimumSampleTime_;
+    std::vector<Benchmark> benchmarks_;
+    std::vector<BenchmarkResult> results_;
+};
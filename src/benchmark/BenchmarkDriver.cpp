@@ -0,0 +1,750 @@
+#include "Benchmark.h"
+#include "../cards/Cards.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapLoader.h"
+#include "../orders/Orders.h"
+#include "../player/IssuedMovesLedger.h"
+#include "../profiling/AllocationTracker.h"
+#include "../profiling/Profiler.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    const std::string RESOURCES_DIRECTORY = "resources";
+
+    // Armies placed on every territory of the order benchmarks, so that repeated orders never run out of armies
+    const int FIXTURE_ARMIES = 1000000;
+
+    // Games that run longer than this are restarted so that stalemates do not dominate the phase benchmarks
+    const int MAXIMUM_ROUNDS_PER_GAME = 100;
+
+    enum MapFormat : short
+    {
+        DOMINATION,
+        CONQUEST
+    };
+
+    struct LoadedMap
+    {
+        std::string name;
+        std::string path;
+        MapFormat format;
+        Map* map;
+    };
+
+    // Load every valid map in the resources directory, trying the Domination format first like the game menu does.
+    std::vector<LoadedMap> loadMaps()
+    {
+        std::vector<std::string> paths;
+        for (const auto &entry : fs::directory_iterator(RESOURCES_DIRECTORY))
+        {
+            paths.push_back(entry.path().string());
+        }
+        sort(paths.begin(), paths.end());
+
+        std::vector<LoadedMap> maps;
+        for (const auto &path : paths)
+        {
+            std::string name = fs::path(path).filename().string();
+            try
+            {
+                MapLoader loader;
+                maps.push_back({ name, path, DOMINATION, loader.loadMap(path) });
+                continue;
+            }
+            catch (char const *errorMessage) {}
+            catch (std::string const errorMessage) {}
+
+            try
+            {
+                ConquestFileReader reader;
+                maps.push_back({ name, path, CONQUEST, reader.readConquestFile(path) });
+            }
+            catch (char const *errorMessage)
+            {
+                std::cerr << "Skipping " << name << ": " << errorMessage << std::endl;
+            }
+            catch (std::string const errorMessage)
+            {
+                std::cerr << "Skipping " << name << ": " << errorMessage << std::endl;
+            }
+        }
+
+        return maps;
+    }
+
+    // Start a game between AI players on a copy of `map`
+    void startGame(GameEngine &gameEngine, const Map &map)
+    {
+        GameEngine::setMap(new Map(map));
+        GameEngine::setPlayers({
+            new Player("Aggressive", new AggressivePlayerStrategy()),
+            new Player("Benevolent", new BenevolentPlayerStrategy()),
+            new Player("Aggressive 2", new AggressivePlayerStrategy())
+        });
+        GameEngine::setSeed(42);
+
+        Deck* deck = GameEngine::getDeck();
+        if (deck->size() < 50)
+        {
+            deck->generateCards(50 - deck->size());
+        }
+
+        gameEngine.startupPhase();
+    }
+
+    // A game is over once a player has been eliminated (or has conquered everything), or it has gone on for too long
+    bool isGameOver(int round)
+    {
+        for (const auto &player : GameEngine::getPlayers())
+        {
+            if (player->getOwnedTerritories().empty())
+            {
+                return true;
+            }
+        }
+
+        return round >= MAXIMUM_ROUNDS_PER_GAME;
+    }
+
+    Player* findPlayer(std::string name)
+    {
+        for (const auto &player : GameEngine::getPlayers())
+        {
+            if (player->getName() == name)
+            {
+                return player;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Benchmarks one phase of the game loop: each operation plays a full round, but only `timedPhase` is timed.
+    Benchmark phaseBenchmark(std::string name, const Map* map, Phase timedPhase)
+    {
+        auto gameEngine = std::make_shared<GameEngine>();
+        auto round = std::make_shared<int>(0);
+
+        auto setup = [=](int) {
+            startGame(*gameEngine, *map);
+            *round = 0;
+        };
+
+        auto operation = [=](int) {
+            Benchmark::pauseTiming();
+            if (isGameOver(*round))
+            {
+                startGame(*gameEngine, *map);
+                *round = 0;
+            }
+
+            for (const auto &phase : { REINFORCEMENT, ISSUE_ORDERS, EXECUTE_ORDERS })
+            {
+                if (phase == timedPhase)
+                {
+                    Benchmark::resumeTiming();
+                }
+
+                switch (phase)
+                {
+                    case REINFORCEMENT:
+                        gameEngine->reinforcementPhase();
+                        break;
+                    case ISSUE_ORDERS:
+                        gameEngine->issueOrdersPhase();
+                        break;
+                    default:
+                        gameEngine->executeOrdersPhase();
+                }
+
+                if (phase == timedPhase)
+                {
+                    Benchmark::pauseTiming();
+                }
+            }
+
+            (*round)++;
+            Benchmark::resumeTiming();
+        };
+
+        return Benchmark(name, setup, operation, nullptr);
+    }
+
+    // Benchmarks single calls to a player's issueOrder(). Once the player is done for the turn,
+    // the other players issue their orders and the round is played out without timing.
+    Benchmark issueOrderBenchmark(std::string name, const Map* map, std::string playerName)
+    {
+        auto gameEngine = std::make_shared<GameEngine>();
+        auto round = std::make_shared<int>(0);
+
+        auto setup = [=](int) {
+            startGame(*gameEngine, *map);
+            gameEngine->reinforcementPhase();
+            *round = 0;
+        };
+
+        auto operation = [=](int) {
+            Player* player = findPlayer(playerName);
+            if (player->isDoneIssuingOrders())
+            {
+                Benchmark::pauseTiming();
+                gameEngine->issueOrdersPhase();
+                gameEngine->executeOrdersPhase();
+                (*round)++;
+                if (isGameOver(*round))
+                {
+                    startGame(*gameEngine, *map);
+                    *round = 0;
+                }
+                gameEngine->reinforcementPhase();
+                player = findPlayer(playerName);
+                Benchmark::resumeTiming();
+            }
+
+            player->issueOrder();
+        };
+
+        return Benchmark(name, setup, operation, nullptr);
+    }
+
+    // Two players facing each other on a copy of `map`, with territories dealt out alternately by id.
+    // Every territory holds FIXTURE_ARMIES armies.
+    struct Skirmish
+    {
+        Player* attacker;
+        Player* defender;
+        std::vector<Territory*> attackerTerritories;
+        std::vector<Territory*> defenderTerritories;
+        std::vector<std::pair<Territory*, Territory*>> friendlyBorders;
+        std::vector<std::pair<Territory*, Territory*>> enemyBorders;
+
+        void start(const Map &map)
+        {
+            GameEngine::setMap(new Map(map));
+            attacker = new Player("Attacker", new AggressivePlayerStrategy());
+            defender = new Player("Defender", new AggressivePlayerStrategy());
+            GameEngine::setPlayers({ attacker, defender });
+
+            std::vector<Territory*> territories = GameEngine::getMap()->getTerritories();
+            sort(territories.begin(), territories.end(), [](const auto &t1, const auto &t2) { return t1->getId() < t2->getId(); });
+            for (size_t i = 0; i < territories.size(); i++)
+            {
+                Player* owner = i % 2 == 0 ? attacker : defender;
+                owner->addOwnedTerritory(territories.at(i));
+                territories.at(i)->addArmies(FIXTURE_ARMIES);
+            }
+
+            attackerTerritories = attacker->getOwnedTerritories();
+            defenderTerritories = defender->getOwnedTerritories();
+            friendlyBorders.clear();
+            enemyBorders.clear();
+            for (const auto &source : attackerTerritories)
+            {
+                for (const auto &destination : GameEngine::getMap()->getAdjacentTerritories(source))
+                {
+                    Player* owner = GameEngine::getOwnerOf(destination);
+                    auto &borders = owner == attacker ? friendlyBorders : enemyBorders;
+                    borders.push_back({ source, destination });
+                }
+            }
+        }
+    };
+
+    // Benchmarks Order::execute() on orders built for a skirmish. `afterExecute` runs untimed after each order.
+    Benchmark orderBenchmark(std::string name, const Map* map, std::function<Order*(Skirmish &, int)> buildOrder, std::function<void(Skirmish &, int)> afterExecute = nullptr)
+    {
+        auto skirmish = std::make_shared<Skirmish>();
+        auto orders = std::make_shared<std::vector<Order*>>();
+
+        auto setup = [=](int batchSize) {
+            skirmish->start(*map);
+            for (int i = 0; i < batchSize; i++)
+            {
+                orders->push_back(buildOrder(*skirmish, i));
+            }
+        };
+
+        auto operation = [=](int i) {
+            orders->at(i)->execute();
+
+            if (afterExecute)
+            {
+                Benchmark::pauseTiming();
+                afterExecute(*skirmish, i);
+                Benchmark::resumeTiming();
+            }
+        };
+
+        auto teardown = [=]() {
+            for (const auto &order : *orders)
+            {
+                delete order;
+            }
+            orders->clear();
+        };
+
+        return Benchmark(name, setup, operation, teardown);
+    }
+
+    // Copying or moving objects built by `build`, which is not timed. Moves are measured on their own, since a copy also
+    // leaves something to move.
+    template <typename T>
+    Benchmark copyOrMoveBenchmark(std::string name, std::function<T*(int)> build, bool moving)
+    {
+        auto sources = std::make_shared<std::vector<T*>>();
+        auto results = std::make_shared<std::vector<T*>>();
+
+        auto setup = [=](int batchSize) {
+            for (int i = 0; i < batchSize; i++)
+            {
+                sources->push_back(build(i));
+            }
+            results->reserve(batchSize);
+        };
+
+        auto operation = [=](int i) {
+            T* source = sources->at(i);
+            results->push_back(moving ? new T(std::move(*source)) : new T(*source));
+        };
+
+        auto teardown = [=]() {
+            for (const auto &objects : { sources, results })
+            {
+                for (const auto &object : *objects)
+                {
+                    delete object;
+                }
+                objects->clear();
+            }
+        };
+
+        return Benchmark(name, setup, operation, teardown);
+    }
+
+    void addMapBenchmarks(BenchmarkSuite &suite, const std::vector<LoadedMap> &maps)
+    {
+        for (const auto &loadedMap : maps)
+        {
+            std::string path = loadedMap.path;
+            if (loadedMap.format == DOMINATION)
+            {
+                suite.add(Benchmark("MapLoader::loadMap/" + loadedMap.name, [=](int) {
+                    MapLoader loader;
+                    delete loader.loadMap(path);
+                }));
+            }
+            else
+            {
+                suite.add(Benchmark("ConquestFileReader::readConquestFile/" + loadedMap.name, [=](int) {
+                    ConquestFileReader reader;
+                    delete reader.readConquestFile(path);
+                }));
+            }
+        }
+
+        for (const auto &loadedMap : maps)
+        {
+            Map* map = loadedMap.map;
+            suite.add(Benchmark("Map::validate/" + loadedMap.name, [=](int) {
+                map->validate();
+            }));
+        }
+
+        for (const auto &loadedMap : maps)
+        {
+            Map* map = loadedMap.map;
+            suite.add(Benchmark("Map::Map(const Map &)/" + loadedMap.name, [=](int) {
+                delete new Map(*map);
+            }));
+        }
+
+        for (const auto &loadedMap : maps)
+        {
+            Map* map = loadedMap.map;
+            suite.add(copyOrMoveBenchmark<Map>("Map::Map(Map &&)/" + loadedMap.name, [=](int) { return new Map(*map); }, true));
+        }
+    }
+
+    // Copying against moving each class that owns what it holds, filled like in the middle of a game
+    void addCopyAndMoveBenchmarks(BenchmarkSuite &suite)
+    {
+        const int ORDERS_PER_PLAYER = 32;
+        const int CARDS_PER_HAND = 5;
+        const int CARDS_PER_DECK = 50;
+
+        auto buildOrders = [](int) {
+            OrdersList* orders = new OrdersList();
+            for (int j = 0; j < ORDERS_PER_PLAYER; j++)
+            {
+                orders->add(j % 2 == 0 ? (Order*) new DeployOrder() : (Order*) new AdvanceOrder());
+            }
+            return orders;
+        };
+        auto buildHand = [](int) {
+            std::vector<CardType> cards;
+            for (int j = 0; j < CARDS_PER_HAND; j++)
+            {
+                cards.push_back(j % 2 == 0 ? BOMB_CARD : AIRLIFT_CARD);
+            }
+            return new Hand(cards);
+        };
+        auto buildDeck = [](int) {
+            Deck* deck = new Deck();
+            deck->generateCards(CARDS_PER_DECK);
+            return deck;
+        };
+        auto buildPlayer = [](int i) {
+            Player* player = new Player("Player " + std::to_string(i), new AggressivePlayerStrategy());
+            for (int j = 0; j < ORDERS_PER_PLAYER; j++)
+            {
+                player->addOrder(new DeployOrder());
+            }
+            return player;
+        };
+
+        suite.add(copyOrMoveBenchmark<OrdersList>("OrdersList::OrdersList(const OrdersList &)", buildOrders, false));
+        suite.add(copyOrMoveBenchmark<OrdersList>("OrdersList::OrdersList(OrdersList &&)", buildOrders, true));
+        suite.add(copyOrMoveBenchmark<Hand>("Hand::Hand(const Hand &)", buildHand, false));
+        suite.add(copyOrMoveBenchmark<Hand>("Hand::Hand(Hand &&)", buildHand, true));
+        suite.add(copyOrMoveBenchmark<Deck>("Deck::Deck(const Deck &)", buildDeck, false));
+        suite.add(copyOrMoveBenchmark<Deck>("Deck::Deck(Deck &&)", buildDeck, true));
+        suite.add(copyOrMoveBenchmark<Player>("Player::Player(const Player &)", buildPlayer, false));
+        suite.add(copyOrMoveBenchmark<Player>("Player::Player(Player &&)", buildPlayer, true));
+    }
+
+    void addOrdersListBenchmarks(BenchmarkSuite &suite)
+    {
+        // Orders are spread over lists of a typical turn's size, so that the cost per operation does not depend on the batch size
+        const int ORDERS_PER_LIST = 32;
+        auto lists = std::make_shared<std::vector<OrdersList*>>();
+        auto orders = std::make_shared<std::vector<Order*>>();
+
+        // Mix of priorities so that sorting has something to do
+        auto buildOrder = [](int i) -> Order* {
+            switch (i % 4)
+            {
+                case 0:
+                    return new DeployOrder();
+                case 1:
+                    return new AirliftOrder();
+                case 2:
+                    return new BlockadeOrder();
+                default:
+                    return new AdvanceOrder();
+            }
+        };
+
+        auto fillLists = [=](int batchSize) {
+            for (int i = 0; i < batchSize; i += ORDERS_PER_LIST)
+            {
+                OrdersList* list = new OrdersList();
+                for (int j = 0; j < ORDERS_PER_LIST; j++)
+                {
+                    list->add(buildOrder(j));
+                }
+                lists->push_back(list);
+            }
+        };
+
+        auto deleteAll = [=]() {
+            for (const auto &list : *lists)
+            {
+                delete list;
+            }
+            lists->clear();
+
+            for (const auto &order : *orders)
+            {
+                delete order;
+            }
+            orders->clear();
+        };
+
+        suite.add(Benchmark("OrdersList::add",
+            [=](int batchSize) {
+                for (int i = 0; i < batchSize; i++)
+                {
+                    orders->push_back(buildOrder(i));
+                }
+                for (int i = 0; i < batchSize; i += ORDERS_PER_LIST)
+                {
+                    lists->push_back(new OrdersList());
+                }
+            },
+            [=](int i) {
+                lists->at(i / ORDERS_PER_LIST)->add(orders->at(i));
+            },
+            [=]() {
+                // The lists own the orders that were added to them
+                orders->clear();
+                deleteAll();
+            }));
+
+        suite.add(Benchmark("OrdersList::peek", fillLists, [=](int i) { lists->at(i / ORDERS_PER_LIST)->peek(); }, deleteAll));
+
+        suite.add(Benchmark("OrdersList::popTopOrder", fillLists,
+            [=](int i) {
+                orders->push_back(lists->at(i / ORDERS_PER_LIST)->popTopOrder());
+            },
+            deleteAll));
+    }
+
+    void addOrderBenchmarks(BenchmarkSuite &suite, const Map* map)
+    {
+        suite.add(orderBenchmark("Order::execute/DeployOrder", map, [](Skirmish &skirmish, int i) -> Order* {
+            Territory* destination = skirmish.attackerTerritories.at(i % skirmish.attackerTerritories.size());
+            return new DeployOrder(skirmish.attacker, 1, destination);
+        }));
+
+        suite.add(orderBenchmark("Order::execute/AdvanceOrder (move)", map, [](Skirmish &skirmish, int i) -> Order* {
+            auto border = skirmish.friendlyBorders.at(i % skirmish.friendlyBorders.size());
+            return new AdvanceOrder(skirmish.attacker, 1, border.first, border.second);
+        }));
+
+        // One army against a full garrison: the attack always fails and the territories keep their owners
+        suite.add(orderBenchmark("Order::execute/AdvanceOrder (attack)", map, [](Skirmish &skirmish, int i) -> Order* {
+            auto border = skirmish.enemyBorders.at(i % skirmish.enemyBorders.size());
+            return new AdvanceOrder(skirmish.attacker, 1, border.first, border.second);
+        }));
+
+        suite.add(orderBenchmark("Order::execute/BombOrder", map, [](Skirmish &skirmish, int i) -> Order* {
+            Territory* target = skirmish.defenderTerritories.at(i % skirmish.defenderTerritories.size());
+            return new BombOrder(skirmish.attacker, target);
+        }));
+
+        // The blockaded territory is handed back to the attacker after each order so that it can be blockaded again
+        suite.add(orderBenchmark("Order::execute/BlockadeOrder", map,
+            [](Skirmish &skirmish, int i) -> Order* {
+                Territory* territory = skirmish.attackerTerritories.at(i % skirmish.attackerTerritories.size());
+                return new BlockadeOrder(skirmish.attacker, territory);
+            },
+            [](Skirmish &skirmish, int i) {
+                Territory* territory = skirmish.attackerTerritories.at(i % skirmish.attackerTerritories.size());
+                GameEngine::getNeutralPlayer()->removeOwnedTerritory(territory);
+                skirmish.attacker->addOwnedTerritory(territory);
+                territory->removeArmies(territory->getNumberOfArmies() - FIXTURE_ARMIES);
+            }));
+
+        suite.add(orderBenchmark("Order::execute/AirliftOrder", map, [](Skirmish &skirmish, int i) -> Order* {
+            std::vector<Territory*> &territories = skirmish.attackerTerritories;
+            Territory* source = territories.at(i % territories.size());
+            Territory* destination = territories.at((i + 1) % territories.size());
+            return new AirliftOrder(skirmish.attacker, 1, source, destination);
+        }));
+
+        // Diplomatic relations only last for a turn, so they are cleared after each order
+        suite.add(orderBenchmark("Order::execute/NegotiateOrder", map,
+            [](Skirmish &skirmish, int) -> Order* {
+                return new NegotiateOrder(skirmish.attacker, skirmish.defender);
+            },
+            [](Skirmish &skirmish, int) {
+                skirmish.attacker->endTurn();
+                skirmish.defender->endTurn();
+            }));
+    }
+
+    void addIssuedMovesLedgerBenchmarks(BenchmarkSuite &suite)
+    {
+        // Moves are recorded in ledgers of a typical turn's size, from territories with a handful of neighbors each
+        const int MOVES_PER_TURN = 32;
+        const int NEIGHBORS_PER_TERRITORY = 4;
+        auto ledgers = std::make_shared<std::vector<IssuedMovesLedger>>();
+
+        auto emptyLedgers = [=](int batchSize) {
+            ledgers->assign(batchSize / MOVES_PER_TURN + 1, IssuedMovesLedger());
+        };
+        auto fillLedgers = [=](int batchSize) {
+            emptyLedgers(batchSize);
+            for (int i = 0; i < batchSize; i++)
+            {
+                ledgers->at(i / MOVES_PER_TURN).recordAdvance(i / NEIGHBORS_PER_TERRITORY, i);
+            }
+        };
+
+        suite.add(Benchmark("IssuedMovesLedger::recordAdvance", emptyLedgers,
+            [=](int i) {
+                ledgers->at(i / MOVES_PER_TURN).recordAdvance(i / NEIGHBORS_PER_TERRITORY, i);
+            },
+            [=]() { ledgers->clear(); }));
+
+        suite.add(Benchmark("IssuedMovesLedger::hasAdvanced", fillLedgers,
+            [=](int i) {
+                ledgers->at(i / MOVES_PER_TURN).hasAdvanced(i / NEIGHBORS_PER_TERRITORY, i + i % 2);
+            },
+            [=]() { ledgers->clear(); }));
+
+        suite.add(Benchmark("IssuedMovesLedger::clear", fillLedgers, [=](int i) { ledgers->at(i / MOVES_PER_TURN).clear(); },
+            [=]() { ledgers->clear(); }));
+    }
+
+    void addDeckBenchmarks(BenchmarkSuite &suite)
+    {
+        // Cards are drawn from decks of a typical game's size
+        const int CARDS_PER_DECK = 50;
+        auto decks = std::make_shared<std::vector<Deck*>>();
+        auto cards = std::make_shared<std::vector<const Card*>>();
+
+        suite.add(Benchmark("Deck::draw",
+            [=](int batchSize) {
+                for (int i = 0; i < batchSize; i += CARDS_PER_DECK)
+                {
+                    Deck* deck = new Deck();
+                    deck->generateCards(CARDS_PER_DECK);
+                    decks->push_back(deck);
+                }
+                cards->reserve(batchSize);
+            },
+            [=](int i) {
+                cards->push_back(decks->at(i / CARDS_PER_DECK)->draw());
+            },
+            [=]() {
+                for (const auto &deck : *decks)
+                {
+                    delete deck;
+                }
+                decks->clear();
+                cards->clear();
+            }));
+
+        // Hands of mostly bombs, searched for a card that is not one, as the benevolent strategy does
+        auto hands = std::make_shared<std::vector<Hand>>();
+        suite.add(Benchmark("Hand::removeCard(CardType)",
+            [=](int batchSize) {
+                hands->assign(batchSize, Hand({ BOMB_CARD, BOMB_CARD, BOMB_CARD, BOMB_CARD, DIPLOMACY_CARD }));
+            },
+            [=](int i) {
+                for (int type = 0; type < NUMBER_OF_CARD_TYPES; type++)
+                {
+                    if (type != BOMB_CARD && hands->at(i).removeCard(static_cast<CardType>(type)) != nullptr)
+                    {
+                        break;
+                    }
+                }
+            },
+            [=]() { hands->clear(); }));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Usage: WarzoneBench [--filter text] [--samples n] [--min-sample-ms n] [--output file.json] [--perf] [--track-allocations]
+    BenchmarkSuite suite;
+    std::string outputFile;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string option = argv[i];
+        if (option == "--perf")
+        {
+            PerfCounters::setEnabled(true);
+            continue;
+        }
+        if (option == "--track-allocations")
+        {
+            AllocationTracker::setEnabled(true);
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for option: " << option << std::endl;
+            return 1;
+        }
+
+        std::string value = argv[++i];
+        if (option == "--filter")
+        {
+            suite.setFilter(value);
+        }
+        else if (option == "--samples")
+        {
+            suite.setSamples(std::stoi(value));
+        }
+        else if (option == "--min-sample-ms")
+        {
+            suite.setMinimumSampleTime(std::chrono::milliseconds(std::stoi(value)));
+        }
+        else if (option == "--output")
+        {
+            outputFile = value;
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+
+    if (PerfCounters::isEnabled() && !PerfCounters::isSupported())
+    {
+        std::cerr << "Hardware counters are unavailable on this system, they will be reported as 0" << std::endl;
+    }
+    if (AllocationTracker::isEnabled() && !Profiler::isEnabled())
+    {
+        std::cerr << "Allocation tags are compiled out (-DWARZONE_PROFILING=ON), every allocation will be reported as untagged" << std::endl;
+    }
+
+    // The benchmarks measure the game logic, not the console
+    Logger::setLevel(OFF_LEVEL);
+
+    std::vector<LoadedMap> maps = loadMaps();
+    auto isCanada = [](const auto &loadedMap) { return loadedMap.name == "canada.map"; };
+    auto canada = find_if(maps.begin(), maps.end(), isCanada);
+    if (canada == maps.end())
+    {
+        std::cerr << "resources/canada.map is required to run the benchmarks" << std::endl;
+        return 1;
+    }
+
+    addMapBenchmarks(suite, maps);
+    addOrdersListBenchmarks(suite);
+    addOrderBenchmarks(suite, canada->map);
+    addDeckBenchmarks(suite);
+    addIssuedMovesLedgerBenchmarks(suite);
+    addCopyAndMoveBenchmarks(suite);
+
+    suite.add(issueOrderBenchmark("AggressivePlayerStrategy::issueOrder", canada->map, "Aggressive"));
+    suite.add(issueOrderBenchmark("BenevolentPlayerStrategy::issueOrder", canada->map, "Benevolent"));
+
+    for (const auto &loadedMap : maps)
+    {
+        suite.add(phaseBenchmark("GameEngine::reinforcementPhase/" + loadedMap.name, loadedMap.map, REINFORCEMENT));
+        suite.add(phaseBenchmark("GameEngine::issueOrdersPhase/" + loadedMap.name, loadedMap.map, ISSUE_ORDERS));
+        suite.add(phaseBenchmark("GameEngine::executeOrdersPhase/" + loadedMap.name, loadedMap.map, EXECUTE_ORDERS));
+    }
+
+    suite.run(std::cerr);
+
+    // Allocations of the whole run (setup included) by engine phase and subsystem
+    if (AllocationTracker::isEnabled())
+    {
+        AllocationTracker::report(std::cerr);
+    }
+
+    if (outputFile.empty())
+    {
+        suite.writeJson(std::cout);
+    }
+    else
+    {
+        std::ofstream output(outputFile);
+        suite.writeJson(output);
+    }
+
+    for (const auto &loadedMap : maps)
+    {
+        delete loadedMap.map;
+    }
+    GameEngine::resetGameEngine();
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "../cards/Cards.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Number of players of the games in the sweep, unless given on the command line
+    const std::vector<int> DEFAULT_PLAYER_COUNTS = { 100, 250, 500, 1000 };
+
+    // Number of cards the deck starts every game with, like a game started from the menu
+    const int CARDS_PER_GAME = 50;
+
+    struct ScalingResult
+    {
+        int players;
+        int territories;
+        double startupSeconds;
+        int rounds;
+        long orders;
+        double roundSeconds;
+    };
+
+    // Half Aggressive and half Benevolent players, alternating
+    std::vector<Player*> createPlayers(int numberOfPlayers)
+    {
+        std::vector<Player*> players;
+        for (int i = 0; i < numberOfPlayers; i++)
+        {
+            if (i % 2 == 0)
+            {
+                players.push_back(new Player("Aggressive " + std::to_string(i + 1), new AggressivePlayerStrategy()));
+            }
+            else
+            {
+                players.push_back(new Player("Benevolent " + std::to_string(i + 1), new BenevolentPlayerStrategy()));
+            }
+        }
+
+        return players;
+    }
+
+    // Play up to `maximumRounds` rounds of a free-for-all between `numberOfPlayers` players on a copy of `map`
+    ScalingResult playGame(const Map* map, int numberOfPlayers, int maximumRounds)
+    {
+        GameEngine gameEngine;
+        GameEngine::setDeck(new Deck());
+        GameEngine::getDeck()->generateCards(CARDS_PER_GAME);
+        GameEngine::setMap(new Map(*map));
+        GameEngine::setPlayers(createPlayers(numberOfPlayers));
+        GameEngine::setSeed(1);
+
+        auto start = std::chrono::steady_clock::now();
+        gameEngine.startupPhase();
+        auto startupEnd = std::chrono::steady_clock::now();
+        while (gameEngine.getRound() < maximumRounds && gameEngine.playRound()) {}
+        auto end = std::chrono::steady_clock::now();
+
+        ScalingResult result = {
+            numberOfPlayers,
+            GameEngine::getMap()->getNumberOfTerritories(),
+            std::chrono::duration<double>(startupEnd - start).count(),
+            gameEngine.getRound(),
+            gameEngine.getNumberOfOrdersExecuted(),
+            std::chrono::duration<double>(end - startupEnd).count()
+        };
+        GameEngine::resetGameEngine();
+
+        return result;
+    }
+
+    std::vector<int> parsePlayerCounts(const std::string &value)
+    {
+        std::vector<int> playerCounts;
+        std::istringstream counts(value);
+        std::string count;
+        while (std::getline(counts, count, ','))
+        {
+            playerCounts.push_back(std::stoi(count));
+        }
+
+        return playerCounts;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Usage: WarzonePlayerScaling [--players n,n,...] [--width n] [--height n] [--continent-size n] [--rounds n]
+    std::vector<int> playerCounts = DEFAULT_PLAYER_COUNTS;
+    int width = 100;
+    int height = 100;
+    int continentSize = 5;
+    int maximumRounds = 10;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for option: " << option << std::endl;
+            return 2;
+        }
+
+        std::string value = argv[++i];
+        if (option == "--players")
+        {
+            playerCounts = parsePlayerCounts(value);
+        }
+        else if (option == "--width")
+        {
+            width = std::stoi(value);
+        }
+        else if (option == "--height")
+        {
+            height = std::stoi(value);
+        }
+        else if (option == "--continent-size")
+        {
+            continentSize = std::stoi(value);
+        }
+        else if (option == "--rounds")
+        {
+            maximumRounds = std::stoi(value);
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 2;
+        }
+    }
+
+    // The sweep measures the game logic, not the console
+    Logger::setLevel(OFF_LEVEL);
+
+    MapGenerator generator(width, height, continentSize);
+    Map* map = generator.generateMap();
+    std::cout << "[PlayerScaling] " << generator << ", up to " << maximumRounds << " rounds per game" << std::endl;
+
+    // Per-round cost should follow the territories and the orders, so time per order stays flat as players are added
+    std::cout << std::right << std::setw(8) << "Players" << std::setw(12) << "Territories" << std::setw(12) << "Startup s";
+    std::cout << std::setw(8) << "Rounds" << std::setw(14) << "Orders/round" << std::setw(12) << "ms/round" << std::setw(12) << "us/order" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto &numberOfPlayers : playerCounts)
+    {
+        if (numberOfPlayers < 2 || numberOfPlayers > map->getNumberOfTerritories())
+        {
+            std::cerr << "Skipping " << numberOfPlayers << " players: every player needs a territory on a map of " << map->getNumberOfTerritories() << std::endl;
+            continue;
+        }
+
+        ScalingResult result = playGame(map, numberOfPlayers, maximumRounds);
+        int rounds = std::max(result.rounds, 1);
+        std::cout << std::setw(8) << result.players << std::setw(12) << result.territories << std::setw(12) << result.startupSeconds;
+        std::cout << std::setw(8) << result.rounds << std::setw(14) << (double)result.orders / rounds;
+        std::cout << std::setw(12) << 1000 * result.roundSeconds / rounds;
+        std::cout << std::setw(12) << 1000000 * result.roundSeconds / std::max(result.orders, 1L) << std::endl;
+    }
+
+    delete map;
+    return 0;
+}
@@ -0,0 +1,288 @@
+#include "Throughput.h"
+#include "../cards/Cards.h"
+#include "../game_engine/GameEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+    // Mixes of AI players every map is played with
+    const std::vector<std::vector<std::string>> MATCHUPS = {
+        { "Aggressive", "Benevolent" },
+        { "Aggressive", "Aggressive", "Benevolent" },
+        { "Aggressive", "Benevolent", "Benevolent" }
+    };
+
+    // Number of cards the deck starts every game with, like a game started from the menu
+    const int CARDS_PER_GAME = 50;
+
+    // Maps stop being repeated once their games have taken this long. Long runs are less noisy to begin with.
+    const double MAXIMUM_SECONDS_PER_MAP = 5;
+
+    std::vector<Player*> createPlayers(const std::vector<std::string> &strategies)
+    {
+        std::vector<Player*> players;
+        for (size_t i = 0; i < strategies.size(); i++)
+        {
+            std::string name = strategies.at(i) + " " + std::to_string(i + 1);
+            if (strategies.at(i) == "Aggressive")
+            {
+                players.push_back(new Player(name, new AggressivePlayerStrategy()));
+            }
+            else
+            {
+                players.push_back(new Player(name, new BenevolentPlayerStrategy()));
+            }
+        }
+
+        return players;
+    }
+
+    ThroughputResult makeResult(std::string name, int games, long rounds, long orders, double seconds)
+    {
+        return { name, games, rounds, orders, seconds, games / seconds, rounds / seconds, orders / seconds };
+    }
+
+    // Compare one metric against the baseline. Returns false if it dropped by more than `tolerance`.
+    bool compareMetric(const std::string &name, const std::string &metric, double current, double baseline, double tolerance, std::ostream &output)
+    {
+        double change = baseline == 0 ? 0 : (current - baseline) / baseline;
+        bool regressed = change < -tolerance;
+        output << std::left << std::setw(24) << name << std::setw(18) << metric << std::right << std::setw(14) << baseline;
+        output << std::setw(14) << current << std::setw(11) << std::showpos << 100 * change << std::noshowpos << "%";
+        output << (regressed ? "  REGRESSION" : "") << "\n";
+        return !regressed;
+    }
+}
+
+
+/*
+===================================
+ Implementation for ThroughputResult
+===================================
+ */
+
+std::ostream &operator<<(std::ostream &output, const ThroughputResult &result)
+{
+    output << "[Throughput] " << result.name << ": " << result.games << " games, " << result.rounds << " rounds, " << result.orders << " orders in ";
+    output << result.seconds << " s (" << result.gamesPerSecond << " games/s, " << result.roundsPerSecond << " rounds/s, ";
+    output << result.ordersPerSecond << " orders/s)";
+    return output;
+}
+
+
+/*
+===================================
+ Implementation for ThroughputHarness class
+===================================
+ */
+
+// Constructors
+ThroughputHarness::ThroughputHarness() : gamesPerMatchup_(1), maximumRounds_(50), repetitions_(5) {}
+
+ThroughputHarness::ThroughputHarness(const ThroughputHarness &harness)
+    : gamesPerMatchup_(harness.gamesPerMatchup_), maximumRounds_(harness.maximumRounds_), repetitions_(harness.repetitions_), maps_(harness.maps_) {}
+
+// Operator overloading
+const ThroughputHarness &ThroughputHarness::operator=(const ThroughputHarness &harness)
+{
+    if (this != &harness)
+    {
+        gamesPerMatchup_ = harness.gamesPerMatchup_;
+        maximumRounds_ = harness.maximumRounds_;
+        repetitions_ = harness.repetitions_;
+        maps_ = harness.maps_;
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const ThroughputHarness &harness)
+{
+    output << "[ThroughputHarness] " << harness.maps_.size() << " maps, " << MATCHUPS.size() << " matchups, ";
+    output << harness.gamesPerMatchup_ << " games per matchup, up to " << harness.maximumRounds_ << " rounds per game";
+    return output;
+}
+
+// Setters
+// Games are played with the seeds 1 to `games` for each matchup.
+void ThroughputHarness::setGamesPerMatchup(int games)
+{
+    if (games < 1)
+    {
+        throw "At least one game per matchup is required.";
+    }
+    gamesPerMatchup_ = games;
+}
+
+// Games still running after this many rounds are stopped, so that stalemates cannot run forever.
+void ThroughputHarness::setMaximumRounds(int rounds)
+{
+    if (rounds < 1)
+    {
+        throw "Games need to be allowed at least one round.";
+    }
+    maximumRounds_ = rounds;
+}
+
+// The games of every map are played up to this many times and the fastest run is kept.
+void ThroughputHarness::setRepetitions(int repetitions)
+{
+    if (repetitions < 1)
+    {
+        throw "At least one repetition is required.";
+    }
+    repetitions_ = repetitions;
+}
+
+// Add a map to play on. Every game gets its own copy, so the map must outlive the harness but is never modified.
+void ThroughputHarness::addMap(std::string name, const Map* map)
+{
+    maps_.push_back({ name, map });
+}
+
+// Play the games of every map, followed by a `total` result over all of them
+std::vector<ThroughputResult> ThroughputHarness::run(std::ostream &progress) const
+{
+    std::vector<ThroughputResult> results;
+    int games = 0;
+    long rounds = 0;
+    long orders = 0;
+    double seconds = 0;
+
+    for (const auto &map : maps_)
+    {
+        results.push_back(playGames_(map.first, map.second));
+        progress << results.back() << std::endl;
+
+        games += results.back().games;
+        rounds += results.back().rounds;
+        orders += results.back().orders;
+        seconds += results.back().seconds;
+    }
+
+    results.push_back(makeResult("total", games, rounds, orders, seconds));
+    progress << results.back() << std::endl;
+
+    return results;
+}
+
+// Write results in the baseline format: a header line, then one line of whitespace-separated fields per result
+void ThroughputHarness::writeBaseline(std::ostream &output, const std::vector<ThroughputResult> &results)
+{
+    output << "# name games rounds orders seconds games_per_second rounds_per_second orders_per_second\n";
+    for (const auto &result : results)
+    {
+        output << result.name << " " << result.games << " " << result.rounds << " " << result.orders << " " << result.seconds << " ";
+        output << result.gamesPerSecond << " " << result.roundsPerSecond << " " << result.ordersPerSecond << "\n";
+    }
+}
+
+std::vector<ThroughputResult> ThroughputHarness::readBaseline(std::istream &input)
+{
+    std::vector<ThroughputResult> baseline;
+    std::string line;
+    while (getline(input, line))
+    {
+        if (line.empty() || line.front() == '#')
+        {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        ThroughputResult result;
+        fields >> result.name >> result.games >> result.rounds >> result.orders >> result.seconds;
+        fields >> result.gamesPerSecond >> result.roundsPerSecond >> result.ordersPerSecond;
+        if (fields.fail())
+        {
+            throw "Invalid baseline line: " + line;
+        }
+        baseline.push_back(result);
+    }
+
+    return baseline;
+}
+
+// Print how every result compares to its baseline and return false if any throughput dropped by more than `tolerance` (e.g. 0.1 for 10%).
+// Results without a baseline are reported but never fail the comparison.
+bool ThroughputHarness::compare(const std::vector<ThroughputResult> &results, const std::vector<ThroughputResult> &baseline, double tolerance, std::ostream &output)
+{
+    output << std::left << std::setw(24) << "Workload" << std::setw(18) << "Metric" << std::right << std::setw(14) << "Baseline";
+    output << std::setw(14) << "Current" << std::setw(12) << "Change" << "\n";
+    output << std::fixed << std::setprecision(2);
+
+    bool passed = true;
+    for (const auto &result : results)
+    {
+        auto isSameWorkload = [&result](const ThroughputResult &entry) { return entry.name == result.name; };
+        auto expected = find_if(baseline.begin(), baseline.end(), isSameWorkload);
+        if (expected == baseline.end())
+        {
+            output << std::left << std::setw(24) << result.name << "no baseline" << std::right << "\n";
+            continue;
+        }
+
+        // Throughputs of different amounts of work are not comparable, e.g. after a change to the strategies
+        if (expected->games != result.games || expected->rounds != result.rounds || expected->orders != result.orders)
+        {
+            output << std::left << std::setw(24) << result.name << "workload changed (" << expected->rounds << " rounds, " << expected->orders;
+            output << " orders in the baseline, now " << result.rounds << " rounds, " << result.orders << " orders)" << std::right << "\n";
+        }
+
+        passed = compareMetric(result.name, "games/s", result.gamesPerSecond, expected->gamesPerSecond, tolerance, output) && passed;
+        passed = compareMetric(result.name, "rounds/s", result.roundsPerSecond, expected->roundsPerSecond, tolerance, output) && passed;
+        passed = compareMetric(result.name, "orders/s", result.ordersPerSecond, expected->ordersPerSecond, tolerance, output) && passed;
+    }
+
+    output.unsetf(std::ios::floatfield);
+    output << std::setprecision(6);
+    return passed;
+}
+
+// Play every matchup on a map, keeping the fastest of the repetitions
+ThroughputResult ThroughputHarness::playGames_(const std::string &name, const Map* map) const
+{
+    GameEngine gameEngine;
+    int games = 0;
+    long rounds = 0;
+    long orders = 0;
+    double fastestSeconds = 0;
+    double totalSeconds = 0;
+
+    for (int repetition = 0; repetition < repetitions_ && totalSeconds < MAXIMUM_SECONDS_PER_MAP; repetition++)
+    {
+        games = 0;
+        rounds = 0;
+        orders = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for (const auto &matchup : MATCHUPS)
+        {
+            for (int game = 0; game < gamesPerMatchup_; game++)
+            {
+                GameEngine::setDeck(new Deck());
+                GameEngine::getDeck()->generateCards(CARDS_PER_GAME);
+                GameEngine::setMap(new Map(*map));
+                GameEngine::setPlayers(createPlayers(matchup));
+                GameEngine::setSeed(game + 1);
+
+                gameEngine.startupPhase();
+                while (gameEngine.getRound() < maximumRounds_ && gameEngine.playRound()) {}
+
+                games++;
+                rounds += gameEngine.getRound();
+                orders += gameEngine.getNumberOfOrdersExecuted();
+            }
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        totalSeconds += seconds;
+        if (repetition == 0 || seconds < fastestSeconds)
+        {
+            fastestSeconds = seconds;
+        }
+    }
+
+    return makeResult(name, games, rounds, orders, fastestSeconds);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../map/Map.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Work done by the games played on a map and how fast it was done
+struct ThroughputResult
+{
+    std::string name;
+    int games;
+    long rounds;
+    long orders;
+    double seconds;
+    double gamesPerSecond;
+    double roundsPerSecond;
+    double ordersPerSecond;
+};
+
+std::ostream &operator<<(std::ostream &output, const ThroughputResult &result);
+
+
+// Plays fixed-seed games between AI players on a set of maps and measures games, rounds and orders per second.
+// Every map is played with the same mixes of Aggressive and Benevolent players, and the same seeds, so runs are comparable.
+class ThroughputHarness
+{
+public:
+    ThroughputHarness();
+    ThroughputHarness(const ThroughputHarness &harness);
+    const ThroughputHarness &operator=(const ThroughputHarness &harness);
+    friend std::ostream &operator<<(std::ostream &output, const ThroughputHarness &harness);
+    void setGamesPerMatchup(int games);
+    void setMaximumRounds(int rounds);
+    void setRepetitions(int repetitions);
+    void addMap(std::string name, const Map* map);
+    std::vector<ThroughputResult> run(std::ostream &progress) const;
+    static void writeBaseline(std::ostream &output, const std::vector<ThroughputResult> &results);
+    static std::vector<ThroughputResult> readBaseline(std::istream &input);
+    static bool compare(const std::vector<ThroughputResult> &results, const std::vector<ThroughputResult> &baseline, double tolerance, std::ostream &output);
+
+private:
+    int gamesPerMatchup_;
+    int maximumRounds_;
+    int repetitions_;
+    std::vector<std::pair<std::string, const Map*>> maps_;
+    ThroughputResult playGames_(const std::string &name, const Map* map) const;
+};
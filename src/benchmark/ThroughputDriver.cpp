@@ -0,0 +1,192 @@
+#include "Throughput.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapGenerator.h"
+#include "../map_loader/MapLoader.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    const std::string RESOURCES_DIRECTORY = "resources";
+
+    // Generated maps played on top of the bundled ones: { width, height, continent size }
+    const std::vector<std::vector<int>> GENERATED_MAPS = {
+        { 16, 16, 4 },
+        { 24, 24, 4 }
+    };
+
+    // Load every valid map in the resources directory, trying the Domination format first like the game menu does
+    std::vector<std::pair<std::string, Map*>> loadMaps()
+    {
+        std::vector<std::string> paths;
+        for (const auto &entry : fs::directory_iterator(RESOURCES_DIRECTORY))
+        {
+            paths.push_back(entry.path().string());
+        }
+        sort(paths.begin(), paths.end());
+
+        std::vector<std::pair<std::string, Map*>> maps;
+        for (const auto &path : paths)
+        {
+            std::string name = fs::path(path).filename().string();
+            MapLoader dominationLoader;
+            ConquestFileReaderAdapter conquestLoader;
+            std::string error;
+            for (MapLoader* loader : std::vector<MapLoader*>{ &dominationLoader, &conquestLoader })
+            {
+                try
+                {
+                    maps.push_back({ name, loader->loadMap(path) });
+                    error.clear();
+                    break;
+                }
+                catch (char const *errorMessage)
+                {
+                    error = errorMessage;
+                }
+                catch (std::string const errorMessage)
+                {
+                    error = errorMessage;
+                }
+            }
+
+            if (!error.empty())
+            {
+                std::cerr << "Skipping " << name << ": " << error << std::endl;
+            }
+        }
+
+        return maps;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Usage: WarzoneThroughput [--filter text] [--games n] [--max-rounds n] [--repetitions n]
+    //                          [--baseline file] [--tolerance percent] [--write-baseline file]
+    ThroughputHarness harness;
+    std::string filter;
+    std::string baselineFile;
+    std::string outputFile;
+    double tolerance = 0.10;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for option: " << option << std::endl;
+            return 2;
+        }
+
+        std::string value = argv[++i];
+        try
+        {
+            if (option == "--filter")
+            {
+                filter = value;
+            }
+            else if (option == "--games")
+            {
+                harness.setGamesPerMatchup(std::stoi(value));
+            }
+            else if (option == "--max-rounds")
+            {
+                harness.setMaximumRounds(std::stoi(value));
+            }
+            else if (option == "--repetitions")
+            {
+                harness.setRepetitions(std::stoi(value));
+            }
+            else if (option == "--baseline")
+            {
+                baselineFile = value;
+            }
+            else if (option == "--tolerance")
+            {
+                tolerance = std::stod(value) / 100;
+            }
+            else if (option == "--write-baseline")
+            {
+                outputFile = value;
+            }
+            else
+            {
+                std::cerr << "Unknown option: " << option << std::endl;
+                return 2;
+            }
+        }
+        catch (char const *errorMessage)
+        {
+            std::cerr << errorMessage << std::endl;
+            return 2;
+        }
+    }
+
+    // The harness measures the game logic, not the console
+    Logger::setLevel(OFF_LEVEL);
+
+    std::vector<std::pair<std::string, Map*>> maps = loadMaps();
+    for (const auto &size : GENERATED_MAPS)
+    {
+        MapGenerator generator(size.at(0), size.at(1), size.at(2));
+        maps.push_back({ generator.getName(), generator.generateMap() });
+    }
+
+    for (const auto &map : maps)
+    {
+        if (map.first.find(filter) != std::string::npos)
+        {
+            harness.addMap(map.first, map.second);
+        }
+    }
+
+    std::cout << harness << std::endl;
+    std::vector<ThroughputResult> results = harness.run(std::cout);
+
+    if (!outputFile.empty())
+    {
+        std::ofstream output(outputFile);
+        ThroughputHarness::writeBaseline(output, results);
+        std::cout << "\nBaseline written to " << outputFile << std::endl;
+    }
+
+    // Gate on the baseline: exit with 1 if any throughput regressed by more than the tolerance
+    bool passed = true;
+    if (!baselineFile.empty())
+    {
+        std::ifstream input(baselineFile);
+        if (!input.is_open())
+        {
+            std::cerr << "Unable to open baseline file: " << baselineFile << std::endl;
+            return 2;
+        }
+
+        std::vector<ThroughputResult> baseline;
+        try
+        {
+            baseline = ThroughputHarness::readBaseline(input);
+        }
+        catch (std::string const errorMessage)
+        {
+            std::cerr << errorMessage << std::endl;
+            return 2;
+        }
+
+        std::cout << "\nComparison with " << baselineFile << " (tolerance " << 100 * tolerance << "%):" << std::endl;
+        passed = ThroughputHarness::compare(results, baseline, tolerance, std::cout);
+        std::cout << (passed ? "\nNo regressions." : "\nThroughput regressed.") << std::endl;
+    }
+
+    for (const auto &map : maps)
+    {
+        delete map.second;
+    }
+    GameEngine::resetGameEngine();
+
+    return passed ? 0 : 1;
+}
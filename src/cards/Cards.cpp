@@ -1,7 +1,9 @@
 #include "Cards.h"
 #include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
 #include <algorithm>
-#include <time.h>
+#include <limits>
+#include <utility>
 
 namespace
 {
@@ -36,15 +38,17 @@ std::ostream &operator<<(std::ostream &output, const Card &card)
     return card.print_(output);
 }
 
-// Getter and Setter
-Player Card::getOwner() const
+// The card of the specified type
+const Card* Card::get(CardType type)
 {
-    return *owner_;
-}
+    static const BombCard BOMB;
+    static const ReinforcementCard REINFORCEMENT;
+    static const BlockadeCard BLOCKADE;
+    static const AirliftCard AIRLIFT;
+    static const DiplomacyCard DIPLOMACY;
+    static const Card* const CARDS[NUMBER_OF_CARD_TYPES] = { &BOMB, &REINFORCEMENT, &BLOCKADE, &AIRLIFT, &DIPLOMACY };
 
-void Card::setOwner(Player* owner)
-{
-    owner_ = owner;
+    return CARDS[type];
 }
 
 
@@ -55,32 +59,44 @@ void Card::setOwner(Player* owner)
  */
 
 // Constructors
-Deck::Deck() {}
+Deck::Deck() : size_(0)
+{
+    counts_.fill(0);
+}
 
-Deck::Deck(const Deck &deck)
+Deck::Deck(const Deck &deck) : counts_(deck.counts_), size_(deck.size_), random_(deck.random_) {}
+
+// A moved deck takes over the cards of `deck`, which is left empty, and carries on with its random number generator
+Deck::Deck(Deck &&deck) noexcept : counts_(deck.counts_), size_(deck.size_), random_(deck.random_)
 {
-    for (const auto &card : deck.cards_)
-    {
-        cards_.push_back(card->clone());
-    }
+    deck.counts_.fill(0);
+    deck.size_ = 0;
 }
 
 // Destructor
-Deck::~Deck()
+Deck::~Deck() {}
+
+// Operator overloading
+const Deck &Deck::operator=(const Deck &deck)
 {
-    for (const auto &card : cards_)
+    if (this != &deck)
     {
-        delete card;
+        counts_ = deck.counts_;
+        size_ = deck.size_;
+        random_ = deck.random_;
     }
-    cards_.clear();
+    return *this;
 }
 
-// Operator overloading
-const Deck &Deck::operator=(const Deck &deck)
+const Deck &Deck::operator=(Deck &&deck) noexcept
 {
     if (this != &deck)
     {
-        setCards(deck.cards_);
+        counts_ = deck.counts_;
+        size_ = deck.size_;
+        random_ = deck.random_;
+        deck.counts_.fill(0);
+        deck.size_ = 0;
     }
     return *this;
 }
@@ -91,78 +107,71 @@ std::ostream &operator<<(std::ostream &output, const Deck &deck)
     return output;
 }
 
-// Getter and setter
-std::vector<Card*> Deck::getCards() const
+// Getters and setter
+std::vector<const Card*> Deck::getCards() const
 {
-    return cards_;
+    std::vector<const Card*> cards;
+    cards.reserve(size_);
+    for (int type = 0; type < NUMBER_OF_CARD_TYPES; type++)
+    {
+        cards.insert(cards.end(), counts_[type], Card::get(static_cast<CardType>(type)));
+    }
+    return cards;
 }
 
-void Deck::setCards(std::vector<Card*> cards)
+int Deck::getCount(CardType type) const
 {
-    for (const auto &card : cards_)
-    {
-        delete card;
-    }
-    cards_.clear();
+    return counts_[type];
+}
 
-    for (const auto &card : cards)
-    {
-        cards_.push_back(card->clone());
-    }
+// Seed the Deck's own random number generator. Decks do not share the global one, so that games can run side by side.
+void Deck::setSeed(unsigned int seed)
+{
+    random_.seed(seed);
 }
 
-// Pick a random card from the deck and return a pointer to it. The selected card is removed from the deck.
-Card* Deck::draw()
+// Pick a random card from the deck, every card being as likely to be drawn, and return it. The card is removed from the deck.
+const Card* Deck::draw()
 {
-    if (cards_.empty())
+    if (size_ == 0)
     {
-        std::cout << "Deck is empty." << std::endl;
+        LOG_WARNING("Deck is empty.\n");
         return nullptr;
     }
 
-    srand(time(nullptr));
-    int randomIndex = rand() % cards_.size();
-    auto randomCard = cards_.at(randomIndex);
-    cards_.erase(cards_.begin() + randomIndex);
+    // Find the type the randomly picked card falls into
+    int randomIndex = std::uniform_int_distribution<int>(0, size_ - 1)(random_);
+    int type = 0;
+    while (randomIndex >= counts_[type])
+    {
+        randomIndex -= counts_[type];
+        type++;
+    }
 
-    return randomCard;
+    counts_[type]--;
+    size_--;
+    return Card::get(static_cast<CardType>(type));
 }
 
 // Get the number of cards in the deck.
 int Deck::size() const
 {
-    return cards_.size();
+    return size_;
 }
 
 // Add a card to the deck.
-void Deck::addCard(Card* card)
+void Deck::addCard(CardType type)
 {
-    cards_.push_back(card);
+    counts_[type]++;
+    size_++;
 }
 
-// Generate a number of cards and insert into the deck.
+// Generate a number of cards and insert into the deck, as many of each type as possible.
 void Deck::generateCards(int numberOfCards)
 {
-    const int NUMBER_OF_CARD_TYPES = 5;
     for (int i = 0; i < numberOfCards; i++)
     {
-        switch (i % NUMBER_OF_CARD_TYPES)
-        {
-            case 0: 
-                cards_.push_back(new BombCard());
-                break;
-            case 1:
-                cards_.push_back(new ReinforcementCard());
-                break;
-            case 2:
-                cards_.push_back(new BlockadeCard());
-                break;
-            case 3:
-                cards_.push_back(new AirliftCard());
-                break;
-            default:
-                cards_.push_back(new DiplomacyCard());
-        }
+        addCard(static_cast<CardType>(i % NUMBER_OF_CARD_TYPES));
     }
 }
 
@@ -174,32 +183,50 @@ void Deck::generateCards(int numberOfCards)
  */
 
 // Constructors
-Hand::Hand() {}
+Hand::Hand() : size_(0)
+{
+    counts_.fill(0);
+}
 
-Hand::Hand(const Hand &hand)
+Hand::Hand(const std::vector<CardType> &cards) : Hand()
 {
-    for (auto card : hand.cards_)
+    for (const auto &type : cards)
     {
-        cards_.push_back(card->clone());
+        addCard(type);
     }
 }
 
+Hand::Hand(const Hand &hand) : counts_(hand.counts_), size_(hand.size_) {}
+
+// A moved hand takes over the cards of `hand`, which is left empty
+Hand::Hand(Hand &&hand) noexcept : counts_(hand.counts_), size_(hand.size_)
+{
+    hand.counts_.fill(0);
+    hand.size_ = 0;
+}
+
 // Destructor
-Hand::~Hand()
+Hand::~Hand() {}
+
+// Operator overloading
+const Hand &Hand::operator=(const Hand &hand)
 {
-    for (const auto &card : cards_)
+    if (this != &hand)
     {
-        delete card;
+        counts_ = hand.counts_;
+        size_ = hand.size_;
     }
-    cards_.clear();
+    return *this;
 }
 
-// Operator overloading
-const Hand &Hand::operator=(const Hand &hand)
+const Hand &Hand::operator=(Hand &&hand) noexcept
 {
     if (this != &hand)
     {
-        setCards(hand.cards_);
+        counts_ = hand.counts_;
+        size_ = hand.size_;
+        hand.counts_.fill(0);
+        hand.size_ = 0;
     }
     return *this;
 }
@@ -210,59 +237,83 @@ std::ostream &operator<<(std::ostream &output, const Hand &hand)
     return output;
 }
 
-// Getter and setter
-std::vector<Card*> Hand::getCards() const
+// Getters
+std::vector<const Card*> Hand::getCards() const
 {
-    return cards_;
+    std::vector<const Card*> cards;
+    cards.reserve(size_);
+    for (int type = 0; type < NUMBER_OF_CARD_TYPES; type++)
+    {
+        cards.insert(cards.end(), counts_[type], Card::get(static_cast<CardType>(type)));
+    }
+    return cards;
 }
 
-void Hand::setCards(std::vector<Card*> cards)
+int Hand::getCount(CardType type) const
 {
-    for (const auto &card : cards_)
-    {
-        delete card;
-    }
-    cards_.clear();
+    return counts_[type];
+}
 
-    for (const auto &card : cards)
-    {
-        cards_.push_back(card->clone());
-    }
+bool Hand::hasCard(CardType type) const
+{
+    return counts_[type] > 0;
 }
 
 // Get the card at the specified position
-Card* Hand::at(int position)
+const Card* Hand::at(int position) const
 {
-    if (position < 0 || position > cards_.size() - 1)
+    if (position < 0 || position >= size_)
     {
         return nullptr;
     }
 
-    return cards_.at(position);
+    int type = 0;
+    while (position >= counts_[type])
+    {
+        position -= counts_[type];
+        type++;
+    }
+    return Card::get(static_cast<CardType>(type));
 }
 
 // Get the number of cards in the hand.
 int Hand::size() const
 {
-    return cards_.size();
+    return size_;
 }
 
 // Add a card to the player's hand.
-void Hand::addCard(Card* card)
+void Hand::addCard(CardType type)
 {
-    cards_.push_back(card);
+    counts_[type]++;
+    size_++;
 }
 
 // Remove and return a card from the player's hand indicated by `position`.
-Card* Hand::removeCard(int position)
+const Card* Hand::removeCard(int position)
 {
-    auto cardPosition = cards_.begin() + position;
-    Card* card = *cardPosition;
-    cards_.erase(cardPosition);
-
+    const Card* card = at(position);
+    if (card != nullptr)
+    {
+        counts_[card->getType()]--;
+        size_--;
+    }
     return card;
 }
 
+// Remove and return a card of the specified type from the player's hand. Returns nullptr if there is none.
+const Card* Hand::removeCard(CardType type)
+{
+    if (!hasCard(type))
+    {
+        return nullptr;
+    }
+
+    counts_[type]--;
+    size_--;
+    return Card::get(type);
+}
+
 
 /* 
 ===================================
@@ -277,42 +328,42 @@ std::ostream &BombCard::print_(std::ostream &output) const
     return output;
 }
 
-// Return a pointer to a new instance of BombCard.
-Card* BombCard::clone() const
+// Get the type of the Card sub-class
+CardType BombCard::getType() const
 {
-    return new BombCard();
+    return BOMB_CARD;
 }
 
 // Generate a BombOrder when the card is played.
-Order* BombCard::play() const
+Order* BombCard::play(Player* owner) const
 {
-    if (owner_ == nullptr)
+    if (owner == nullptr)
     {
         return new BombOrder();
     }
 
-    if (owner_->isHuman())
+    if (owner->isHuman())
     {
-        return buildOrder_();
+        return buildOrder_(owner);
     }
 
     // Bomb the highest priority territory in the `toAttack` list
-    return new BombOrder(owner_, owner_->toAttack().front());
+    return new BombOrder(owner, owner->toAttack().front());
 }
 
 // Build the BombOrder through user input.
-Order* BombCard::buildOrder_() const
+Order* BombCard::buildOrder_(Player* owner) const
 {
     // Determine which territories are bombable
     std::vector<Territory*> bombableTerritories;
-    for (const auto &player : getEnemiesOf(owner_))
+    for (const auto &player : getEnemiesOf(owner))
     {
         std::vector<Territory*> enemyTerritories = player->getOwnedTerritories();
         bombableTerritories.insert(bombableTerritories.end(), enemyTerritories.begin(), enemyTerritories.end());
     }
 
     std::cout << "\nWhich territory would you like to bomb?" << std::endl;
-    for (int i = 0; i < bombableTerritories.size(); i++)
+    for (size_t i = 0; i < bombableTerritories.size(); i++)
     {
         Territory* territory = bombableTerritories.at(i);
         std::cout << "[" << i+1 << "] " << territory->getName() << " (" << territory->getNumberOfArmies() << " present)" << std::endl;
@@ -325,7 +376,7 @@ Order* BombCard::buildOrder_() const
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= bombableTerritories.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(bombableTerritories.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -336,7 +387,7 @@ Order* BombCard::buildOrder_() const
         target = bombableTerritories.at(selection - 1);
     }
 
-    return new BombOrder(owner_, target);
+    return new BombOrder(owner, target);
 }
 
 
@@ -353,25 +404,25 @@ std::ostream &ReinforcementCard::print_(std::ostream &output) const
     return output;
 }
 
-// Return a pointer to a new instance of ReinforcementCard.
-Card* ReinforcementCard::clone() const
+// Get the type of the Card sub-class
+CardType ReinforcementCard::getType() const
 {
-    return new ReinforcementCard();
+    return REINFORCEMENT_CARD;
 }
 
 // Add 5 reinforcements to the player's pool when the card is played.
-Order* ReinforcementCard::play() const
+Order* ReinforcementCard::play(Player* owner) const
 {
-    if (owner_ != nullptr)
+    if (owner != nullptr)
     {
-        owner_->addReinforcements(5);
+        owner->addReinforcements(5);
     }
 
     return nullptr;
 }
 
 // Do nothing since ReinforcementCard returns no order
-Order* ReinforcementCard::buildOrder_() const
+Order* ReinforcementCard::buildOrder_(Player*) const
 {
     return nullptr;
 }
@@ -389,36 +440,36 @@ std::ostream &BlockadeCard::print_(std::ostream &output) const
     return output;
 }
 
-// Return a pointer to a new instance of BlockadeCard.
-Card* BlockadeCard::clone() const
+// Get the type of the Card sub-class
+CardType BlockadeCard::getType() const
 {
-    return new BlockadeCard();
+    return BLOCKADE_CARD;
 }
 
 // Generate a BlockadeOrder when the card is played.
-Order* BlockadeCard::play() const
+Order* BlockadeCard::play(Player* owner) const
 {
-    if (owner_ == nullptr)
+    if (owner == nullptr)
     {
         return new BlockadeOrder();
     }
 
-    if (owner_->isHuman())
+    if (owner->isHuman())
     {
-        return buildOrder_();
+        return buildOrder_(owner);
     }
 
     // Setup a blockade on the territory with lowest defend priority
-    return new BlockadeOrder(owner_, owner_->toDefend().back());
+    return new BlockadeOrder(owner, owner->toDefend().back());
 }
 
 // Build the BlockadeOrder through user input.
-Order* BlockadeCard::buildOrder_() const
+Order* BlockadeCard::buildOrder_(Player* owner) const
 {
-    std::vector<Territory*> blockadableTerritories = owner_->getOwnedTerritories();
+    std::vector<Territory*> blockadableTerritories = owner->getOwnedTerritories();
 
     std::cout << "\nWhich territory would you like to blockade?" << std::endl;
-    for (int i = 0; i < blockadableTerritories.size(); i++)
+    for (size_t i = 0; i < blockadableTerritories.size(); i++)
     {
         Territory* territory = blockadableTerritories.at(i);
         std::cout << "[" << i+1 << "] " << territory->getName() << " (" << territory->getNumberOfArmies() << " present, " << territory->getPendingIncomingArmies() << " pending)" << std::endl;
@@ -431,7 +482,7 @@ Order* BlockadeCard::buildOrder_() const
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= blockadableTerritories.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(blockadableTerritories.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -442,7 +493,7 @@ Order* BlockadeCard::buildOrder_() const
         target = blockadableTerritories.at(selection - 1);
     }
 
-    return new BlockadeOrder(owner_, target);
+    return new BlockadeOrder(owner, target);
 }
 
 
@@ -459,30 +510,30 @@ std::ostream &AirliftCard::print_(std::ostream &output) const
     return output;
 }
 
-// Return a pointer to a new instance of AirliftCard.
-Card* AirliftCard::clone() const
+// Get the type of the Card sub-class
+CardType AirliftCard::getType() const
 {
-    return new AirliftCard();
+    return AIRLIFT_CARD;
 }
 
 // Generate an AirliftOrder when the card is played.
-Order* AirliftCard::play() const
+Order* AirliftCard::play(Player* owner) const
 {
-    if (owner_ == nullptr || owner_->getOwnedTerritories().size() == 1)
+    if (owner == nullptr || owner->getOwnedTerritories().size() == 1)
     {
         return new AirliftOrder();
     }
 
-    if (owner_->isHuman())
+    if (owner->isHuman())
     {
-        return buildOrder_();
+        return buildOrder_(owner);
     }
 
     // Choose the player's territory with the most movable armies as the source
     int maxArmies = 0;
     int movableArmies = 0;
-    Territory* source = owner_->getOwnedTerritories().front();
-    for (const auto &territory : owner_->getOwnedTerritories())
+    Territory* source = owner->getOwnedTerritories().front();
+    for (const auto &territory : owner->getOwnedTerritories())
     {
         movableArmies = territory->getNumberOfArmies() + territory->getPendingIncomingArmies() - territory->getPendingOutgoingArmies();
         if (movableArmies > maxArmies)
@@ -494,7 +545,7 @@ Order* AirliftCard::play() const
 
     // Pick the highest priority territory to defend (that isn't the source)
     Territory* destination = nullptr;
-    for (const auto &territory : owner_->toDefend())
+    for (const auto &territory : owner->toDefend())
     {
         if (territory != source)
         {
@@ -504,16 +555,16 @@ Order* AirliftCard::play() const
     }
 
     source->addPendingOutgoingArmies(movableArmies);
-    return new AirliftOrder(owner_, movableArmies, source, destination);
+    return new AirliftOrder(owner, movableArmies, source, destination);
 }
 
 // Build the AirliftOrder through user input.
-Order* AirliftCard::buildOrder_() const
+Order* AirliftCard::buildOrder_(Player* owner) const
 {
-    std::vector<Territory*> possibleSources = owner_->getOwnTerritoriesWithMovableArmies();
+    std::vector<Territory*> possibleSources = owner->getOwnTerritoriesWithMovableArmies();
 
     std::cout << "\nWhich territory would you like to airlift from?" << std::endl;
-    for (int i = 0; i < possibleSources.size(); i++)
+    for (size_t i = 0; i < possibleSources.size(); i++)
     {
         Territory* territory = possibleSources.at(i);
         std::cout << "[" << i+1 << "] " << territory->getName() << " (" << territory->getNumberOfMovableArmies() << " armies available)" << std::endl;
@@ -526,7 +577,7 @@ Order* AirliftCard::buildOrder_() const
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= possibleSources.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(possibleSources.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -539,7 +590,7 @@ Order* AirliftCard::buildOrder_() const
 
     // Destinations can only be territories that are not the source
     std::vector<Territory*> possibleDestinations;
-    for (const auto &destination : owner_->toDefend())
+    for (const auto &destination : owner->toDefend())
     {
         if (destination != source)
         {
@@ -548,7 +599,7 @@ Order* AirliftCard::buildOrder_() const
     }
 
     std::cout << "\nWhich territory would you like to airlift to?" << std::endl;
-    for (int i = 0; i < possibleDestinations.size(); i++)
+    for (size_t i = 0; i < possibleDestinations.size(); i++)
     {
         Territory* territory = possibleDestinations.at(i);
         std::cout << "[" << i+1 << "] " << territory->getName() << " (" << territory->getNumberOfArmies() << " armies present)" << std::endl;
@@ -561,7 +612,7 @@ Order* AirliftCard::buildOrder_() const
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= possibleDestinations.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(possibleDestinations.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -592,7 +643,7 @@ Order* AirliftCard::buildOrder_() const
     }
 
     source->addPendingOutgoingArmies(armiesToMove);
-    return new AdvanceOrder(owner_, armiesToMove, source, destination);
+    return new AdvanceOrder(owner, armiesToMove, source, destination);
 }
 
 
@@ -609,28 +660,27 @@ std::ostream &DiplomacyCard::print_(std::ostream &output) const
     return output;
 }
 
-// Return a pointer to a new instance of DiplomacyCard.
-Card* DiplomacyCard::clone() const
+// Get the type of the Card sub-class
+CardType DiplomacyCard::getType() const
 {
-    return new DiplomacyCard();
+    return DIPLOMACY_CARD;
 }
 
 // Generate a NegotiateOrder when the card is played.
-Order* DiplomacyCard::play() const
+Order* DiplomacyCard::play(Player* owner) const
 {
-    if (owner_ == nullptr || GameEngine::getPlayers().size() < 2)
+    if (owner == nullptr || GameEngine::getPlayers().size() < 2)
     {
         return new NegotiateOrder();
     }
 
-    if (owner_->isHuman())
+    if (owner->isHuman())
     {
-        return buildOrder_();
+        return buildOrder_(owner);
     }
 
     Map* map = GameEngine::getMap();
-    std::vector<Territory*> ownerTerritories = owner_->getOwnedTerritories();
-    std::vector<Territory*> territoriesToDefend = owner_->toDefend();
+    std::vector<Territory*> territoriesToDefend = owner->toDefend();
 
     // Try to pick an enemy player who has the most armies on an adjacent territory to the highest priority territory in
     // the player's `toDefend()` list
@@ -641,7 +691,7 @@ Order* DiplomacyCard::play() const
 
         for (const auto &neighbor : map->getAdjacentTerritories(territory))
         {
-            bool isEnemyTerritory = find(ownerTerritories.begin(), ownerTerritories.end(), neighbor) == ownerTerritories.end();
+            bool isEnemyTerritory = GameEngine::getOwnerOf(neighbor) != owner;
             if (isEnemyTerritory && neighbor->getNumberOfArmies() > maxArmies)
             {
                 mostReinforcedEnemyTerritory = neighbor;
@@ -652,24 +702,23 @@ Order* DiplomacyCard::play() const
         if (mostReinforcedEnemyTerritory != nullptr)
         {
             Player* targetPlayer = GameEngine::getOwnerOf(mostReinforcedEnemyTerritory);
-            return new NegotiateOrder(owner_, targetPlayer);
+            return new NegotiateOrder(owner, targetPlayer);
         }
     }
 
     // If no suitable target player is found, pick a random enemy
-    srand(time(nullptr));
-    std::vector<Player*> enemyPlayers = getEnemiesOf(owner_);
-    Player* targetPlayer = enemyPlayers.at(rand() % enemyPlayers.size());
-    return new NegotiateOrder(owner_, targetPlayer);
+    std::vector<Player*> enemyPlayers = getEnemiesOf(owner);
+    Player* targetPlayer = enemyPlayers.at(owner->getRandomIndex(enemyPlayers.size()));
+    return new NegotiateOrder(owner, targetPlayer);
 }
 
 // Build the NegotiateOrder through user input.
-Order* DiplomacyCard::buildOrder_() const
+Order* DiplomacyCard::buildOrder_(Player* owner) const
 {
-    std::vector<Player*> enemyPlayers = getEnemiesOf(owner_);
+    std::vector<Player*> enemyPlayers = getEnemiesOf(owner);
 
     std::cout << "\nWho would you like to negotiate with?" << std::endl;
-    for (int i = 0; i < enemyPlayers.size(); i++)
+    for (size_t i = 0; i < enemyPlayers.size(); i++)
     {
         Player* enemy = enemyPlayers.at(i);
         std::cout << "[" << i+1 << "] " << enemy->getName() << std::endl;
@@ -682,7 +731,7 @@ Order* DiplomacyCard::buildOrder_() const
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= enemyPlayers.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(enemyPlayers.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -693,5 +742,5 @@ Order* DiplomacyCard::buildOrder_() const
         targetPlayer = enemyPlayers.at(selection - 1);
     }
 
-    return new NegotiateOrder(owner_, targetPlayer);
+    return new NegotiateOrder(owner, targetPlayer);
 }
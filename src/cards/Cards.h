@@ -2,125 +2,151 @@
 
 #include "../orders/Orders.h"
 #include "../player/Player.h"
+#include <array>
 #include <iostream>
+#include <random>
 #include <vector>
 
 class Order;
 class Player;
 
+enum CardType : short
+{
+    BOMB_CARD,
+    REINFORCEMENT_CARD,
+    BLOCKADE_CARD,
+    AIRLIFT_CARD,
+    DIPLOMACY_CARD,
+};
+
+const int NUMBER_OF_CARD_TYPES = 5;
+
+
+// How a type of card is played. Cards have no state of their own, so there is a single instance of each type (see
+// Card::get()), played on behalf of the player holding it.
 class Card
 {
 public:
     virtual ~Card();
     friend std::ostream &operator<<(std::ostream &output, const Card &card);
-    virtual Card* clone() const = 0;
-    virtual Order* play() const = 0;
-    Player getOwner() const;
-    void setOwner(Player* owner);
+    virtual Order* play(Player* owner) const = 0;
+    virtual CardType getType() const = 0;
+    static const Card* get(CardType type);
 
 protected:
-    Player* owner_;
     virtual std::ostream &print_(std::ostream &output) const = 0;
-    virtual Order* buildOrder_() const = 0;
+    virtual Order* buildOrder_(Player* owner) const = 0;
 };
 
 
+// The cards left to draw, as a number of cards of each type
 class Deck
 {
 public:
     Deck();
     Deck(const Deck &deck);
+    Deck(Deck &&deck) noexcept;
     ~Deck();
     const Deck &operator=(const Deck &deck);
+    const Deck &operator=(Deck &&deck) noexcept;
     friend std::ostream &operator<<(std::ostream &output, const Deck &deck);
-    std::vector<Card*> getCards() const;
-    void setCards(std::vector<Card*> cards);
+    std::vector<const Card*> getCards() const;
+    int getCount(CardType type) const;
+    void setSeed(unsigned int seed);
     int size() const;
-    void addCard(Card* card);
+    void addCard(CardType type);
     void generateCards(int numberOfCards);
-    Card* draw();
+    const Card* draw();
 
 private:
-    std::vector<Card*> cards_;
+    std::array<int, NUMBER_OF_CARD_TYPES> counts_;
+    int size_;
+    std::mt19937 random_;
 };
 
 
+// The cards held by a player, as a number of cards of each type. Positions in the hand go through the types in order.
 class Hand
 {
 public:
     Hand();
-    Hand(std::vector<Card*> cards);
+    Hand(const std::vector<CardType> &cards);
     Hand(const Hand &hand);
+    Hand(Hand &&hand) noexcept;
     ~Hand();
     const Hand &operator=(const Hand &hand);
+    const Hand &operator=(Hand &&hand) noexcept;
     friend std::ostream &operator<<(std::ostream &output, const Hand &hand);
-    std::vector<Card*> getCards() const;
-    void setCards(std::vector<Card*> cards);
-    Card* at(int position);
+    std::vector<const Card*> getCards() const;
+    int getCount(CardType type) const;
+    bool hasCard(CardType type) const;
+    const Card* at(int position) const;
     int size() const;
-    void addCard(Card* card);
-    Card* removeCard(int position);
+    void addCard(CardType type);
+    const Card* removeCard(int position);
+    const Card* removeCard(CardType type);
 
 private:
-    std::vector<Card*> cards_;
+    std::array<int, NUMBER_OF_CARD_TYPES> counts_;
+    int size_;
 };
 
 
 class BombCard : public Card
 {
 public:
-    Order* play() const;
-    Card* clone() const;
+    Order* play(Player* owner) const;
+    CardType getType() const;
 
 protected:
     std::ostream &print_(std::ostream &output) const;
-    Order* buildOrder_() const;
+    Order* buildOrder_(Player* owner) const;
 };
 
 
 class ReinforcementCard : public Card
 {
 public:
-    Order* play() const;
-    Card* clone() const;
+    Order* play(Player* owner) const;
+    CardType getType() const;
 
 protected:
     std::ostream &print_(std::ostream &output) const;
-    Order* buildOrder_() const;
+    Order* buildOrder_(Player* owner) const;
 };
 
 
 class BlockadeCard : public Card
 {
 public:
-    Order* play() const;
-    Card* clone() const;
+    Order* play(Player* owner) const;
+    CardType getType() const;
 
 protected:
     std::ostream &print_(std::ostream &output) const;
-    Order* buildOrder_() const;
+    Order* buildOrder_(Player* owner) const;
 };
 
 
 class AirliftCard : public Card
 {
 public:
-    Order* play() const;
-    Card* clone() const;
+    Order* play(Player* owner) const;
+    CardType getType() const;
 
 protected:
     std::ostream &print_(std::ostream &output) const;
-    Order* buildOrder_() const;
+    Order* buildOrder_(Player* owner) const;
 };
 
 
 class DiplomacyCard : public Card
 {
 public:
-    Order* play() const;
-    Card* clone() const;
+    Order* play(Player* owner) const;
+    CardType getType() const;
 
 protected:
     std::ostream &print_(std::ostream &output) const;
-    Order* buildOrder_() const;
+    Order* buildOrder_(Player* owner) const;
 };
@@ -20,9 +20,14 @@ int main()
     // Fill hand by randomly drawing from deck
     std::cout << "===== " << " Drawing cards from deck " << " =====" << std::endl;
     Hand hand;
-    hand.addCard(deck.draw());
-    hand.addCard(deck.draw());
-    hand.addCard(deck.draw());
+    for (int i = 0; i < 3; i++)
+    {
+        const Card* card = deck.draw();
+        if (card != nullptr)
+        {
+            hand.addCard(card->getType());
+        }
+    }
 
     std::cout << "\n***** " << " Deck after drawing - Size=" << deck.size() << " *****" << std::endl;
     for (const auto &card : deck.getCards())
@@ -44,8 +49,8 @@ int main()
     std::cout << "===== " << " Playing cards in Hand " << " =====" << std::endl;
     while (hand.size() != 0)
     {
-        Card* card = hand.removeCard(0);
-        Order* playResult = card->play();
+        const Card* card = hand.removeCard(0);
+        Order* playResult = card->play(nullptr);
 
         std::cout << *card << " generated: ";
         if (playResult != nullptr)
@@ -58,7 +63,7 @@ int main()
             std::cout << "N/A" << std::endl;
         }
 
-        deck.addCard(card);
+        deck.addCard(card->getType());
     }
 
     std::cout << std::endl;
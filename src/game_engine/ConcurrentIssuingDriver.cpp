@@ -0,0 +1,99 @@
+#include "GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct IssuingResult
+    {
+        int rounds;
+        long ordersExecuted;
+        uint64_t hash;
+        double issueSeconds;
+        std::vector<std::string> turns;
+    };
+
+    // Play rounds between 5 AI players until someone is eliminated, timing the issue orders phase and describing every
+    // turn taken in it as observers see it
+    IssuingResult playRounds(const MapGenerator &generator, bool concurrentIssuing, int maximumRounds)
+    {
+        GameEngine gameEngine;
+        GameEngine::setConcurrentIssuing(concurrentIssuing);
+        GameEngine::setDeck(new Deck());
+        GameEngine::getDeck()->generateCards(50);
+        GameEngine::setMap(generator.generateMap());
+        GameEngine::setPlayers({
+            new Player("Aggressive", new AggressivePlayerStrategy()),
+            new Player("Benevolent", new BenevolentPlayerStrategy()),
+            new Player("Aggressive 2", new AggressivePlayerStrategy()),
+            new Player("Benevolent 2", new BenevolentPlayerStrategy()),
+            new Player("Aggressive 3", new AggressivePlayerStrategy())
+        });
+        GameEngine::setSeed(42);
+        gameEngine.startupPhase();
+
+        IssuingResult result = { 0, 0, 0, 0, {} };
+        gameEngine.getEvents().subscribe<PhaseChanged>(&result, [&result](const PhaseChanged &event) {
+            if (event.phase == ISSUE_ORDERS)
+            {
+                std::ostringstream turn;
+                turn << event.activePlayer->getName() << ": " << event.orders << " orders, " << event.reinforcements;
+                turn << " reinforcements, " << event.cards << " cards";
+                result.turns.push_back(turn.str());
+            }
+        });
+        bool someoneEliminated = false;
+        while (result.rounds < maximumRounds && !someoneEliminated)
+        {
+            gameEngine.reinforcementPhase();
+
+            auto start = std::chrono::steady_clock::now();
+            gameEngine.issueOrdersPhase();
+            result.issueSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            gameEngine.executeOrdersPhase();
+            result.rounds++;
+            for (const auto &player : GameEngine::getPlayers())
+            {
+                someoneEliminated = someoneEliminated || player->getOwnedTerritories().empty();
+            }
+        }
+        result.ordersExecuted = gameEngine.getNumberOfOrdersExecuted();
+        result.hash = gameEngine.getStalemateDetector().getHash();
+
+        gameEngine.getEvents().unsubscribe(&result);
+        GameEngine::resetGameEngine();
+        return result;
+    }
+}
+
+int main()
+{
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+
+    std::cout << "Issuing on up to " << std::max(std::thread::hardware_concurrency(), 1u) << " threads" << std::endl;
+    bool allMatch = true;
+    for (const auto &generator : { MapGenerator(8, 8, 4), MapGenerator(16, 16, 4), MapGenerator(32, 32, 8) })
+    {
+        IssuingResult sequential = playRounds(generator, false, 20);
+        IssuingResult concurrent = playRounds(generator, true, 20);
+        bool match = sequential.rounds == concurrent.rounds && sequential.ordersExecuted == concurrent.ordersExecuted && sequential.hash == concurrent.hash;
+        bool turnsMatch = sequential.turns == concurrent.turns;
+        allMatch = allMatch && match && turnsMatch;
+
+        std::cout << generator.getName() << ": " << sequential.rounds << " rounds, " << sequential.ordersExecuted << " orders executed, ";
+        std::cout << "games " << (match ? "match" : "DO NOT MATCH") << ", " << sequential.turns.size() << " turns observed ";
+        std::cout << (turnsMatch ? "the same" : "DIFFERENTLY") << std::endl;
+        std::cout << "  Issue orders phase: " << sequential.issueSeconds * 1000 << " ms sequentially, ";
+        std::cout << concurrent.issueSeconds * 1000 << " ms concurrently (" << sequential.issueSeconds / concurrent.issueSeconds << "x)" << std::endl;
+    }
+
+    return allMatch ? 0 : 1;
+}
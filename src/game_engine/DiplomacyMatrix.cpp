@@ -0,0 +1,122 @@
+#include "DiplomacyMatrix.h"
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+    const int BITS_PER_WORD = 64;
+}
+
+
+/*
+===================================
+ Implementation for DiplomacyMatrix class
+===================================
+ */
+
+// Constructors
+DiplomacyMatrix::DiplomacyMatrix() : numberOfPlayers_(0), wordsPerRow_(0) {}
+
+std::ostream &operator<<(std::ostream &output, const DiplomacyMatrix &matrix)
+{
+    int relations = 0;
+    for (PlayerId player = 0; player < matrix.numberOfPlayers_; player++)
+    {
+        relations += matrix.getRelations(player).size();
+    }
+    output << "[DiplomacyMatrix] " << matrix.numberOfPlayers_ << " players, " << relations << " relations";
+    return output;
+}
+
+// Getters
+int DiplomacyMatrix::getNumberOfPlayers() const
+{
+    return numberOfPlayers_;
+}
+
+// Ids of the players `player` negotiated with this turn
+std::vector<PlayerId> DiplomacyMatrix::getRelations(PlayerId player) const
+{
+    std::vector<PlayerId> relations;
+    for (PlayerId otherPlayer = 0; otherPlayer < numberOfPlayers_; otherPlayer++)
+    {
+        if (hasRelation(player, otherPlayer))
+        {
+            relations.push_back(otherPlayer);
+        }
+    }
+    return relations;
+}
+
+// Check if `player` negotiated with `otherPlayer` since `player` last ended its turn
+bool DiplomacyMatrix::hasRelation(PlayerId player, PlayerId otherPlayer) const
+{
+    if (!contains_(player) || !contains_(otherPlayer) || !activeRows_[player])
+    {
+        return false;
+    }
+
+    uint64_t word = words_[player * wordsPerRow_ + otherPlayer / BITS_PER_WORD];
+    return (word >> (otherPlayer % BITS_PER_WORD)) & 1;
+}
+
+// Prevent `player` from attacking `otherPlayer` until `player` ends its turn. Players outside of the matrix are ignored.
+void DiplomacyMatrix::addRelation(PlayerId player, PlayerId otherPlayer)
+{
+    if (!contains_(player) || !contains_(otherPlayer))
+    {
+        return;
+    }
+
+    uint64_t* row = &words_[player * wordsPerRow_];
+    if (!activeRows_[player])
+    {
+        std::fill(row, row + wordsPerRow_, 0);
+        activeRows_[player] = true;
+    }
+    row[otherPlayer / BITS_PER_WORD] |= uint64_t(1) << (otherPlayer % BITS_PER_WORD);
+}
+
+// Forget who `player` negotiated with, at the end of its turn
+void DiplomacyMatrix::clearRelations(PlayerId player)
+{
+    if (contains_(player))
+    {
+        activeRows_[player] = false;
+    }
+}
+
+// Make room for players with ids up to `numberOfPlayers - 1`, keeping the relations of the players already there
+void DiplomacyMatrix::resize(int numberOfPlayers)
+{
+    if (numberOfPlayers <= numberOfPlayers_)
+    {
+        return;
+    }
+
+    int wordsPerRow = (numberOfPlayers + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    std::vector<uint64_t> words(numberOfPlayers * wordsPerRow, 0);
+    for (PlayerId player = 0; player < numberOfPlayers_; player++)
+    {
+        std::copy_n(&words_[player * wordsPerRow_], wordsPerRow_, &words[player * wordsPerRow]);
+    }
+
+    words_ = std::move(words);
+    activeRows_.resize(numberOfPlayers, false);
+    numberOfPlayers_ = numberOfPlayers;
+    wordsPerRow_ = wordsPerRow;
+}
+
+// Remove every player, when a new game starts
+void DiplomacyMatrix::clear()
+{
+    numberOfPlayers_ = 0;
+    wordsPerRow_ = 0;
+    words_.clear();
+    activeRows_.clear();
+}
+
+bool DiplomacyMatrix::contains_(PlayerId player) const
+{
+    return player >= 0 && player < numberOfPlayers_;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Handles.h"
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Which players of a game cannot attack which others for the rest of their turn, as a bit matrix indexed by player id.
+// Row `player` holds the players it negotiated with. A player's row is cleared when it ends its turn, in O(1): the row is
+// only marked inactive, and its bits are zeroed the next time the player negotiates.
+// The matrix does no locking. Orders executed on different threads must not update the same row, nor read a row another
+// updates: ExecutionSchedule::getBatches() keeps them in separate batches.
+class DiplomacyMatrix
+{
+public:
+    DiplomacyMatrix();
+    friend std::ostream &operator<<(std::ostream &output, const DiplomacyMatrix &matrix);
+    int getNumberOfPlayers() const;
+    std::vector<PlayerId> getRelations(PlayerId player) const;
+    bool hasRelation(PlayerId player, PlayerId otherPlayer) const;
+    void addRelation(PlayerId player, PlayerId otherPlayer);
+    void clearRelations(PlayerId player);
+    void resize(int numberOfPlayers);
+    void clear();
+
+private:
+    int numberOfPlayers_;
+    int wordsPerRow_;
+    std::vector<uint64_t> words_;
+    std::vector<uint8_t> activeRows_;
+    bool contains_(PlayerId player) const;
+};
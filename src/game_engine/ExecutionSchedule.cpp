@@ -0,0 +1,247 @@
+#include "ExecutionSchedule.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+    // Index of the last batch in which `key` was used, or -1
+    template <typename Key>
+    int getBatch(const std::unordered_map<Key, int> &batches, Key key)
+    {
+        auto iterator = batches.find(key);
+        return iterator == batches.end() ? -1 : iterator->second;
+    }
+}
+
+
+/*
+===================================
+ Implementation for ExecutionSchedule class
+===================================
+ */
+
+// Constructors
+ExecutionSchedule::ExecutionSchedule() {}
+
+// Take every order out of the players' lists and schedule them. The schedule owns the orders from then on.
+ExecutionSchedule::ExecutionSchedule(const std::vector<Player*> &players)
+{
+    int numberOfPlayers = players.size();
+    std::vector<std::vector<Order*>> orders;
+    int numberOfSteps = 0;
+    for (const auto &player : players)
+    {
+        orders.push_back(player->getAllOrders());
+        numberOfSteps += orders.back().size() + 1;
+    }
+    steps_.reserve(numberOfSteps);
+
+    std::vector<int> nextOrder(numberOfPlayers, 0);
+    std::vector<bool> finishedDeploying(numberOfPlayers, false);
+    std::vector<bool> finishedExecutingOrders(numberOfPlayers, false);
+    int playersFinishedDeploying = 0;
+    int playersFinishedExecutingOrders = 0;
+
+    while (playersFinishedExecutingOrders != numberOfPlayers)
+    {
+        for (int i = 0; i < numberOfPlayers; i++)
+        {
+            // Player still has orders to execute
+            if (nextOrder.at(i) < static_cast<int>(orders.at(i).size()))
+            {
+                Order* order = orders.at(i).at(nextOrder.at(i));
+
+                // Non-deploy orders wait until everyone has finished executing their deployments
+                if (order->getType() != DEPLOY && playersFinishedDeploying != numberOfPlayers)
+                {
+                    if (!finishedDeploying.at(i))
+                    {
+                        finishedDeploying.at(i) = true;
+                        playersFinishedDeploying++;
+                    }
+                    continue;
+                }
+
+                steps_.push_back({ players.at(i), order, static_cast<int>(orders.at(i).size()) - nextOrder.at(i) });
+                nextOrder.at(i)++;
+            }
+            // Player has no orders left to execute this turn
+            else
+            {
+                steps_.push_back({ players.at(i), nullptr, 0 });
+                if (!finishedExecutingOrders.at(i))
+                {
+                    finishedExecutingOrders.at(i) = true;
+                    playersFinishedExecutingOrders++;
+                }
+                if (!finishedDeploying.at(i))
+                {
+                    finishedDeploying.at(i) = true;
+                    playersFinishedDeploying++;
+                }
+            }
+        }
+    }
+}
+
+ExecutionSchedule::ExecutionSchedule(const ExecutionSchedule &schedule)
+{
+    copyOrders_(schedule);
+}
+
+// Destructor
+ExecutionSchedule::~ExecutionSchedule()
+{
+    deleteOrders_();
+}
+
+// Operator overloading
+const ExecutionSchedule &ExecutionSchedule::operator=(const ExecutionSchedule &schedule)
+{
+    if (this != &schedule)
+    {
+        deleteOrders_();
+        copyOrders_(schedule);
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const ExecutionSchedule &schedule)
+{
+    output << "[ExecutionSchedule] " << schedule.getNumberOfOrders() << " orders in " << schedule.steps_.size() << " steps";
+    return output;
+}
+
+// Getters
+const std::vector<ScheduledStep> &ExecutionSchedule::getSteps() const
+{
+    return steps_;
+}
+
+int ExecutionSchedule::getNumberOfOrders() const
+{
+    int numberOfOrders = 0;
+    for (const auto &step : steps_)
+    {
+        if (step.order != nullptr)
+        {
+            numberOfOrders++;
+        }
+    }
+
+    return numberOfOrders;
+}
+
+// Group the steps into batches whose steps can execute in any order, or all at once, with the same result as executing
+// them in the order of the schedule. Batches are lists of indices into getSteps(), and must be executed one after the
+// other. A step goes in the batch right after the last batch holding a step scheduled before it that it conflicts with:
+// - Steps conflict if they affect the same territory.
+// - Every order reads the diplomatic relations of its issuer. Negotiating changes those of both players, and ending a
+//   turn clears those of the player, so these conflict with every other step of the players involved.
+// - Blockades may add the Neutral Player to the game, so they are executed on their own.
+// A player ending its turn again when nothing happened to it since its last turn end is left out, as it has no effect
+// apart from being recorded.
+std::vector<std::vector<int>> ExecutionSchedule::getBatches() const
+{
+    std::vector<std::vector<int>> batches;
+    std::unordered_map<Territory*, int> territoryBatches;
+    std::unordered_map<Player*, int> readBatches;
+    std::unordered_map<Player*, int> writeBatches;
+    std::unordered_map<Player*, bool> turnEnded;
+    int blockadeBatch = -1;
+
+    for (size_t i = 0; i < steps_.size(); i++)
+    {
+        Player* player = steps_.at(i).player;
+        Order* order = steps_.at(i).order;
+        if (order == nullptr && turnEnded[player])
+        {
+            continue;
+        }
+
+        std::vector<Player*> readers;
+        std::vector<Player*> writers;
+        std::vector<Territory*> territories;
+        if (order == nullptr)
+        {
+            writers.push_back(player);
+        }
+        else if (order->getType() == NEGOTIATE)
+        {
+            // Negotiating updates the DiplomacyMatrix rows of both players, which is only safe on worker threads if
+            // no other step of the batch reads or updates either of them
+            writers = { player, static_cast<NegotiateOrder*>(order)->getTarget() };
+        }
+        else
+        {
+            readers.push_back(player);
+            territories = order->getAffectedTerritories();
+        }
+
+        int batch = blockadeBatch + 1;
+        if (order != nullptr && order->getType() == BLOCKADE)
+        {
+            batch = batches.size();
+        }
+        for (const auto &territory : territories)
+        {
+            batch = std::max(batch, getBatch(territoryBatches, territory) + 1);
+        }
+        for (const auto &reader : readers)
+        {
+            batch = std::max(batch, getBatch(writeBatches, reader) + 1);
+        }
+        for (const auto &writer : writers)
+        {
+            batch = std::max({ batch, getBatch(writeBatches, writer) + 1, getBatch(readBatches, writer) + 1 });
+        }
+
+        if (batch == static_cast<int>(batches.size()))
+        {
+            batches.push_back({});
+        }
+        batches.at(batch).push_back(i);
+
+        for (const auto &territory : territories)
+        {
+            territoryBatches[territory] = batch;
+        }
+        for (const auto &reader : readers)
+        {
+            readBatches[reader] = std::max(batch, getBatch(readBatches, reader));
+        }
+        for (const auto &writer : writers)
+        {
+            writeBatches[writer] = batch;
+            turnEnded[writer] = false;
+        }
+        if (order == nullptr)
+        {
+            turnEnded[player] = true;
+        }
+        if (order != nullptr && order->getType() == BLOCKADE)
+        {
+            blockadeBatch = batch;
+        }
+    }
+
+    return batches;
+}
+
+// Helper method to copy the steps of another schedule, cloning its orders
+void ExecutionSchedule::copyOrders_(const ExecutionSchedule &schedule)
+{
+    for (const auto &step : schedule.steps_)
+    {
+        steps_.push_back({ step.player, step.order == nullptr ? nullptr : step.order->clone(), step.ordersLeft });
+    }
+}
+
+void ExecutionSchedule::deleteOrders_()
+{
+    for (const auto &step : steps_)
+    {
+        delete step.order;
+    }
+    steps_.clear();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../orders/Orders.h"
+#include "../player/Player.h"
+#include <iostream>
+#include <vector>
+
+class Order;
+class Player;
+
+// A step of the execute orders phase: `player` executes `order`, or ends its turn if `order` is nullptr. `ordersLeft` is
+// the number of orders `player` has left to execute, `order` included.
+struct ScheduledStep
+{
+    Player* player;
+    Order* order;
+    int ordersLeft;
+};
+
+
+// The sequence in which the orders of a round are executed, built once at the start of the execute orders phase.
+// Players take turns in a round-robin fashion. Every player executes its deploy orders first, and the remaining orders in
+// order of priority only start once everyone is done deploying. A player with no orders left ends its turn on each of its
+// turns until everyone is done, exactly like the phase has always done.
+class ExecutionSchedule
+{
+public:
+    ExecutionSchedule();
+    ExecutionSchedule(const std::vector<Player*> &players);
+    ExecutionSchedule(const ExecutionSchedule &schedule);
+    ~ExecutionSchedule();
+    const ExecutionSchedule &operator=(const ExecutionSchedule &schedule);
+    friend std::ostream &operator<<(std::ostream &output, const ExecutionSchedule &schedule);
+    const std::vector<ScheduledStep> &getSteps() const;
+    int getNumberOfOrders() const;
+    std::vector<std::vector<int>> getBatches() const;
+
+private:
+    std::vector<ScheduledStep> steps_;
+    void copyOrders_(const ExecutionSchedule &schedule);
+    void deleteOrders_();
+};
@@ -0,0 +1,250 @@
+#include "GameEngine.h"
+#include "ExecutionSchedule.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapGenerator.h"
+#include "../map_loader/MapLoader.h"
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+
+namespace
+{
+    // std::sort sorts lists of up to this many orders by insertion sort, which keeps orders of the same priority in the
+    // order they were issued. Only longer lists may have them swapped by the legacy loop.
+    const size_t STABLY_SORTED_LIST_SIZE = 16;
+
+    // Description of a step of the execute orders phase, used to compare both ways of sequencing the orders
+    struct StepDescription
+    {
+        std::string player;
+        std::string slot;
+        std::string order;
+        bool operator==(const StepDescription &step) const { return slot == step.slot && order == step.order; }
+        bool operator<(const StepDescription &step) const { return slot < step.slot || (slot == step.slot && order < step.order); }
+    };
+
+    // The slot of a step is who executes it and its priority. Orders of the same priority may only be swapped within a slot.
+    StepDescription describeStep(Player* player, Order* order)
+    {
+        std::ostringstream description;
+        if (order == nullptr)
+        {
+            description << "end turn";
+        }
+        else
+        {
+            description << *order;
+        }
+
+        std::string slot = player->getName() + " " + std::to_string(order == nullptr ? 0 : order->getPriority());
+        return { player->getName(), slot, description.str() };
+    }
+
+    // Whether both sequences execute the same orders in the same slots, with only orders of the same priority swapped, and
+    // only in the orders lists of `playersWithLongLists`. The steps of every other player must be identical.
+    bool isReordering(std::vector<StepDescription> sequence1, std::vector<StepDescription> sequence2,
+                      const std::unordered_set<std::string> &playersWithLongLists)
+    {
+        if (sequence1.size() != sequence2.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < sequence1.size(); i++)
+        {
+            if (sequence1.at(i).slot != sequence2.at(i).slot)
+            {
+                return false;
+            }
+            if (playersWithLongLists.count(sequence1.at(i).player) == 0 && !(sequence1.at(i) == sequence2.at(i)))
+            {
+                return false;
+            }
+        }
+
+        std::sort(sequence1.begin(), sequence1.end());
+        std::sort(sequence2.begin(), sequence2.end());
+        return sequence1 == sequence2;
+    }
+
+    // Sequence of steps of the round-robin loop the execute orders phase used before schedules were built up front
+    std::vector<StepDescription> getLegacySequence(const std::vector<Player*> &players)
+    {
+        std::vector<StepDescription> sequence;
+        std::unordered_set<Player*> playersFinishedDeploying;
+        std::unordered_set<Player*> playersFinishedExecutingOrders;
+        while (playersFinishedExecutingOrders.size() != players.size())
+        {
+            for (auto &player : players)
+            {
+                Order* order = player->peekNextOrder();
+                if (order != nullptr)
+                {
+                    if (order->getType() != DEPLOY && playersFinishedDeploying.size() != players.size())
+                    {
+                        playersFinishedDeploying.insert(player);
+                        continue;
+                    }
+
+                    order = player->getNextOrder();
+                    sequence.push_back(describeStep(player, order));
+                    delete order;
+                }
+                else
+                {
+                    sequence.push_back(describeStep(player, nullptr));
+                    playersFinishedExecutingOrders.insert(player);
+                    playersFinishedDeploying.insert(player);
+                }
+            }
+        }
+
+        return sequence;
+    }
+
+    std::vector<StepDescription> getScheduledSequence(const std::vector<Player*> &players)
+    {
+        std::vector<StepDescription> sequence;
+        ExecutionSchedule schedule(players);
+        for (const auto &step : schedule.getSteps())
+        {
+            sequence.push_back(describeStep(step.player, step.order));
+        }
+
+        return sequence;
+    }
+
+    std::vector<Player*> copyPlayers(const std::vector<Player*> &players)
+    {
+        std::vector<Player*> copies;
+        for (const auto &player : players)
+        {
+            copies.push_back(new Player(*player));
+        }
+
+        return copies;
+    }
+
+    void deletePlayers(std::vector<Player*> &players)
+    {
+        for (const auto &player : players)
+        {
+            delete player;
+        }
+        players.clear();
+    }
+
+    // Play rounds between AI players until someone is eliminated, comparing the schedule of every round with the
+    // sequence the legacy loop produces from a copy of the same orders. Rounds in which every orders list is short enough to
+    // be sorted stably must be identical. In the other rounds, the legacy loop's unstable sort may swap orders of the same
+    // priority in the long lists only. Returns the number of rounds that differ by more than that.
+    int compareRounds(std::string mapName, Map* map, std::vector<Player*> players, int maximumRounds)
+    {
+        GameEngine gameEngine;
+        GameEngine::setDeck(new Deck());
+        GameEngine::getDeck()->generateCards(50);
+        GameEngine::setMap(map);
+        GameEngine::setPlayers(players);
+        GameEngine::setSeed(42);
+        gameEngine.startupPhase();
+
+        int roundsCompared = 0;
+        int shortRoundsCompared = 0;
+        int shortRoundsIdentical = 0;
+        int longRoundsIdentical = 0;
+        int roundsReordered = 0;
+        int roundsDiffering = 0;
+        int ordersCompared = 0;
+        size_t longestOrdersList = 0;
+        bool someoneEliminated = false;
+        while (roundsCompared < maximumRounds && !someoneEliminated)
+        {
+            gameEngine.reinforcementPhase();
+            gameEngine.issueOrdersPhase();
+
+            std::vector<Player*> legacyPlayers = copyPlayers(GameEngine::getPlayers());
+            std::vector<Player*> scheduledPlayers = copyPlayers(GameEngine::getPlayers());
+            std::unordered_set<std::string> playersWithLongLists;
+            for (const auto &player : scheduledPlayers)
+            {
+                size_t ordersListSize = player->getOrdersList().getOrders().size();
+                longestOrdersList = std::max(longestOrdersList, ordersListSize);
+                if (ordersListSize > STABLY_SORTED_LIST_SIZE)
+                {
+                    playersWithLongLists.insert(player->getName());
+                }
+            }
+
+            std::vector<StepDescription> legacySequence = getLegacySequence(legacyPlayers);
+            std::vector<StepDescription> scheduledSequence = getScheduledSequence(scheduledPlayers);
+            bool identical = legacySequence == scheduledSequence;
+            if (playersWithLongLists.empty())
+            {
+                shortRoundsCompared++;
+                shortRoundsIdentical += identical ? 1 : 0;
+                roundsDiffering += identical ? 0 : 1;
+            }
+            else if (identical)
+            {
+                longRoundsIdentical++;
+            }
+            else if (isReordering(legacySequence, scheduledSequence, playersWithLongLists))
+            {
+                roundsReordered++;
+            }
+            else
+            {
+                roundsDiffering++;
+            }
+            ordersCompared += legacySequence.size();
+            roundsCompared++;
+            deletePlayers(legacyPlayers);
+            deletePlayers(scheduledPlayers);
+
+            gameEngine.executeOrdersPhase();
+            for (const auto &player : GameEngine::getPlayers())
+            {
+                someoneEliminated = someoneEliminated || player->getOwnedTerritories().empty();
+            }
+        }
+
+        std::cout << mapName << ": " << roundsCompared << " rounds, " << ordersCompared << " steps compared (longest orders list: ";
+        std::cout << longestOrdersList << ")" << std::endl;
+        std::cout << "  " << shortRoundsIdentical << " of " << shortRoundsCompared << " rounds with every list of ";
+        std::cout << STABLY_SORTED_LIST_SIZE << " orders or fewer identical" << std::endl;
+        std::cout << "  " << roundsCompared - shortRoundsCompared << " rounds with longer lists: " << longRoundsIdentical << " identical, ";
+        std::cout << roundsReordered << " with orders of the same priority swapped in the longer lists" << std::endl;
+        std::cout << "  " << roundsDiffering << " different" << std::endl;
+
+        GameEngine::resetGameEngine();
+        return roundsDiffering;
+    }
+}
+
+int main()
+{
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+
+    // The 16x16 map is large enough for the players to issue long orders lists, the 8x8 one mostly keeps them short
+    MapLoader loader;
+    MapGenerator smallGenerator(8, 8, 4);
+    MapGenerator largeGenerator(16, 16, 4);
+    std::vector<std::pair<std::string, Map*>> maps = {
+        { "canada", loader.loadMap("resources/canada.map") },
+        { smallGenerator.getName(), smallGenerator.generateMap() },
+        { largeGenerator.getName(), largeGenerator.generateMap() }
+    };
+
+    int roundsDiffering = 0;
+    for (const auto &map : maps)
+    {
+        roundsDiffering += compareRounds(map.first, map.second, {
+            new Player("Aggressive", new AggressivePlayerStrategy()),
+            new Player("Benevolent", new BenevolentPlayerStrategy()),
+            new Player("Aggressive 2", new AggressivePlayerStrategy())
+        }, 30);
+    }
+
+    return roundsDiffering == 0 ? 0 : 1;
+}
@@ -1,22 +1,52 @@
 #include "GameEngine.h"
+#include "ExecutionSchedule.h"
+#include "WorkerPool.h"
+#include "../logging/Logger.h"
 #include "../map/Map.h"
 #include "../map_loader/MapLoader.h"
 #include "../orders/Orders.h"
+#include "../profiling/AllocationTracker.h"
+#include "../profiling/Profiler.h"
+#include "../profiling/Tracer.h"
+#include "../recorder/GameRecorder.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <future>
 #include <limits>
 #include <math.h>
 #include <random>
 #include <string>
+#include <thread>
 #include <time.h>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace fs = std::filesystem;
 
 namespace
 {
+    // Size of the batches of orders that are never worth handing out to the execution threads
+    const int NO_PARALLEL_BATCH = std::numeric_limits<int>::max();
+
+    // Largest number of players a game can be set up with from the menu (see WarzonePlayerScaling). Games on smaller maps
+    // are limited to one player per territory.
+    const int MAXIMUM_PLAYERS = 1000;
+
+    // The event of `player` taking its turn in `phase`, with what it had as the turn started
+    PhaseChanged describeTurn(Phase phase, Player* player, const TurnSnapshot &snapshot)
+    {
+        return { phase, player, snapshot.orders, snapshot.reinforcements, snapshot.cards };
+    }
+
+    PhaseChanged describeTurn(Phase phase, Player* player)
+    {
+        return player == nullptr ? PhaseChanged{ phase, nullptr } : describeTurn(phase, player, player->getTurnSnapshot());
+    }
+
     // Helper method for debugging/demo. Pauses game execution until the user presses ENTER on the console.
-    void pause()
+    void waitForEnter()
     {
         std::cout << "Press [Enter] to Continue..." << std::endl;
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(),'\n');
@@ -54,7 +84,7 @@ namespace
             int selection;
             std::cin >> selection;
 
-            if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= maps.size())
+            if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(maps.size()))
             {
                 std::cout << "That was not a valid option. Please try again:" << std::endl;
                 std::cin.clear();
@@ -97,20 +127,21 @@ namespace
         return map;
     }
 
-    // Create players based on user's input.
-    std::vector<Player*> setupPlayers()
+    // Create players based on user's input, up to one per territory of `map`.
+    std::vector<Player*> setupPlayers(Map* map)
     {
         std::cout << "Enter the number of players for this game: ";
         
+        const int maximumPlayers = std::min(MAXIMUM_PLAYERS, map->getNumberOfTerritories());
         int numberOfPlayers = 0;
 
         while (numberOfPlayers == 0)
         {
             std::cin >> numberOfPlayers;
 
-            if (std::cin.fail() || numberOfPlayers < 2 || numberOfPlayers > 5)
+            if (std::cin.fail() || numberOfPlayers < 2 || numberOfPlayers > maximumPlayers)
             {
-                std::cout << "Please enter a valid number of players (2-5): ";
+                std::cout << "Please enter a valid number of players (2-" << maximumPlayers << "): ";
                 std::cin.clear();
                 std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 numberOfPlayers = 0;
@@ -133,9 +164,14 @@ namespace
         return players;
     }
 
-    // Turn on/off specified observers
+    // Turn on/off specified observers. Headless builds have no events for them to display.
     void setupObservers(GameEngine* gameEngine)
     {
+        if constexpr (!EVENTS_ENABLED)
+        {
+            return;
+        }
+
         bool gameStatsObserverOn = true;
         bool phaseObserverOn = true;
         int selection = 0;
@@ -179,9 +215,20 @@ namespace
 
 
 // Initialize static members
-Deck* GameEngine::deck_ = new Deck();
-Map* GameEngine::map_ = new Map();
-std::vector<Player*> GameEngine::players_;
+GameContext GameEngine::defaultContext_ = {
+    .deck = new Deck(),
+    .map = new Map(),
+    .players = {},
+    .recorder = nullptr,
+    .seed = (unsigned int) time(nullptr),
+    .playersById = {},
+    .diplomacy = {},
+    .neutralPlayer = nullptr,
+};
+thread_local GameContext* GameEngine::context_ = &GameEngine::defaultContext_;
+bool GameEngine::concurrentIssuing_ = false;
+WorkerPool* GameEngine::executionPool_ = nullptr;
+int GameEngine::minimumParallelBatchSize_ = 0;
 
 
 /* 
@@ -191,9 +238,13 @@ std::vector<Player*> GameEngine::players_;
  */
 
 // Constructors
-GameEngine::GameEngine() : currentPhase_(NONE), activePlayer_(nullptr) {}
+GameEngine::GameEngine()
+    : currentPhase_(NONE), activePlayer_(nullptr), round_(0), ordersExecuted_(0), endReason_(GAME_IN_PROGRESS), stepSeconds_(0) {}
 
-GameEngine::GameEngine(const GameEngine &gameEngine) : currentPhase_(gameEngine.currentPhase_), activePlayer_(gameEngine.activePlayer_) {}
+GameEngine::GameEngine(const GameEngine &gameEngine)
+    : currentPhase_(gameEngine.currentPhase_), activePlayer_(gameEngine.activePlayer_), round_(gameEngine.round_), ordersExecuted_(gameEngine.ordersExecuted_),
+      endReason_(gameEngine.endReason_), stepSeconds_(gameEngine.stepSeconds_), stalemateDetector_(gameEngine.stalemateDetector_),
+      distributor_(gameEngine.distributor_) {}
 
 // Operator overloading
 const GameEngine &GameEngine::operator=(const GameEngine &gameEngine)
@@ -202,11 +253,17 @@ const GameEngine &GameEngine::operator=(const GameEngine &gameEngine)
     {
         currentPhase_ = gameEngine.currentPhase_;
         activePlayer_ = gameEngine.activePlayer_;
+        round_ = gameEngine.round_;
+        ordersExecuted_ = gameEngine.ordersExecuted_;
+        endReason_ = gameEngine.endReason_;
+        stepSeconds_ = gameEngine.stepSeconds_;
+        stalemateDetector_ = gameEngine.stalemateDetector_;
+        distributor_ = gameEngine.distributor_;
     }
     return *this;
 }
 
-std::ostream &operator<<(std::ostream &output, const GameEngine &gameEngine)
+std::ostream &operator<<(std::ostream &output, const GameEngine &)
 {
     return output;
 }
@@ -214,20 +271,21 @@ std::ostream &operator<<(std::ostream &output, const GameEngine &gameEngine)
 // Static getters
 Deck* GameEngine::getDeck()
 {
-    return deck_;
+    return context_->deck;
 }
 
 Map* GameEngine::getMap()
 {
-    return map_;
+    return context_->map;
 }
 
 std::vector<Player*> GameEngine::getPlayers()
 {
+    Player* neutralPlayer = getNeutralPlayer();
     std::vector<Player*> allPlayers;
-    for (const auto &player : players_)
+    for (const auto &player : context_->players)
     {
-        if (!player->isNeutral())
+        if (player != neutralPlayer)
         {
             allPlayers.push_back(player);
         }
@@ -236,21 +294,114 @@ std::vector<Player*> GameEngine::getPlayers()
     return allPlayers;
 }
 
+DiplomacyMatrix* GameEngine::getDiplomacy()
+{
+    return &context_->diplomacy;
+}
+
+GameRecorder* GameEngine::getRecorder()
+{
+    return context_->recorder;
+}
+
+unsigned int GameEngine::getSeed()
+{
+    return context_->seed;
+}
+
+// Context of the game played on the calling thread
+GameContext* GameEngine::getContext()
+{
+    return context_;
+}
+
+bool GameEngine::isIssuingConcurrently()
+{
+    return concurrentIssuing_;
+}
+
+int GameEngine::getExecutionThreads()
+{
+    return executionPool_ == nullptr ? 1 : executionPool_->getNumberOfThreads();
+}
+
 // Static setters
+void GameEngine::setDeck(Deck* deck)
+{
+    delete context_->deck;
+    context_->deck = deck;
+}
+
 void GameEngine::setMap(Map* map)
 {
-    delete map_;
-    map_ = map;
+    delete context_->map;
+    context_->map = map;
 }
 
 void GameEngine::setPlayers(std::vector<Player*> players)
 {
-    for (const auto &player : players_)
+    for (const auto &player : context_->players)
     {
         delete player;
     }
-    players_.clear();
-    players_ = players;
+    context_->players.clear();
+    context_->players = players;
+
+    context_->playersById = players;
+    context_->neutralPlayer = nullptr;
+    for (size_t i = 0; i < players.size(); i++)
+    {
+        players.at(i)->setId(i);
+        if (players.at(i)->isNeutral())
+        {
+            context_->neutralPlayer = players.at(i);
+        }
+    }
+    context_->diplomacy.clear();
+    context_->diplomacy.resize(players.size());
+}
+
+void GameEngine::setRecorder(GameRecorder* recorder)
+{
+    delete context_->recorder;
+    context_->recorder = recorder;
+}
+
+void GameEngine::setSeed(unsigned int seed)
+{
+    context_->seed = seed;
+}
+
+// Play the game of `context` on the calling thread, or the default game if `context` is nullptr
+void GameEngine::setContext(GameContext* context)
+{
+    context_ = context == nullptr ? &defaultContext_ : context;
+}
+
+// Let AI players issue their orders on worker threads. Games without human players play out the same either way.
+// Off by default: every issue orders phase then starts up to one thread per core, so games played on the small pool of a
+// GameScheduler each use more threads than the pool while they issue. The strategies take little time per order, and
+// starting the threads costs about as much as they save, so it only pays off on several cores with many players.
+void GameEngine::setConcurrentIssuing(bool concurrentIssuing)
+{
+    concurrentIssuing_ = concurrentIssuing;
+}
+
+// Execute orders that do not conflict with each other on `numberOfThreads` threads. With 1 thread, orders are executed one
+// at a time. Games end in the same state either way, but are not recorded when executed on several threads.
+// Rounds are still executed one order at a time unless some batch of orders is worth handing out to the threads (see
+// setMinimumParallelBatchSize()), so observers may be notified either way from one round to the next.
+void GameEngine::setExecutionThreads(int numberOfThreads)
+{
+    delete executionPool_;
+    executionPool_ = numberOfThreads > 1 ? new WorkerPool(numberOfThreads) : nullptr;
+}
+
+// Hand out batches of at least `minimumBatchSize` orders to the execution threads. With 0, the size is worked out from
+// what handing out a batch and executing an order take, and from the number of cores.
+void GameEngine::setMinimumParallelBatchSize(int minimumBatchSize)
+{
+    minimumParallelBatchSize_ = minimumBatchSize;
 }
 
 // Getters (for subject state)
@@ -264,24 +415,69 @@ Player* GameEngine::getActivePlayer() const
     return activePlayer_;
 }
 
+int GameEngine::getRound() const
+{
+    return round_;
+}
+
+// Number of orders executed since the start of the game
+long GameEngine::getNumberOfOrdersExecuted() const
+{
+    return ordersExecuted_;
+}
+
+// Why the game ended, or GAME_IN_PROGRESS
+GameEndReason GameEngine::getEndReason() const
+{
+    return endReason_;
+}
+
+// The draw rules can be configured through the detector before the game starts
+StalemateDetector &GameEngine::getStalemateDetector()
+{
+    return stalemateDetector_;
+}
+
+// How the territories are dealt in the startup phase can be configured before the game starts
+TerritoryDistributor &GameEngine::getDistributor()
+{
+    return distributor_;
+}
+
 std::vector<Player*> GameEngine::getCurrentPlayers() const
 {
-    return players_;
+    return context_->players;
+}
+
+// Find a player of the game by id. Return nullptr if there is none, or if the player was eliminated.
+Player* GameEngine::getPlayer(PlayerId id)
+{
+    return id >= 0 && id < static_cast<int>(context_->playersById.size()) ? context_->playersById[id] : nullptr;
+}
+
+// Find a territory of the game's map by id. Return nullptr if there is none.
+Territory* GameEngine::getTerritory(TerritoryId id)
+{
+    return context_->map == nullptr ? nullptr : context_->map->getTerritory(id);
 }
 
 // Find the player who owns the specified territory. Return nullptr if the territory is unowned.
 Player* GameEngine::getOwnerOf(Territory* territory)
 {
-    for (const auto &player : players_)
+    PROFILE_COUNT(GET_OWNER_OF_COUNTER);
+    return territory->getOwner();
+}
+
+// Find the Neutral Player. Return nullptr if there is none in the game.
+// The player is cached when it joins, and dropped if its strategy has since been changed to another one.
+Player* GameEngine::getNeutralPlayer()
+{
+    if (context_->neutralPlayer != nullptr && !context_->neutralPlayer->isNeutral())
     {
-        std::vector<Territory*> territories = player->getOwnedTerritories();
-        if (find(territories.begin(), territories.end(), territory) != territories.end())
-        {
-            return player;
-        }
+        context_->neutralPlayer = nullptr;
     }
 
-    return nullptr;
+    return context_->neutralPlayer;
 }
 
 // Assign a territory to the Neutral Player. If no such player exists, create one.
@@ -290,17 +486,19 @@ void GameEngine::assignToNeutralPlayer(Territory* territory)
     Player* owner = getOwnerOf(territory);
     owner->removeOwnedTerritory(territory);
 
-    auto isNeutralPlayer = [](const auto &player) { return player->isNeutral(); };
-    auto iterator = find_if(players_.begin(), players_.end(), isNeutralPlayer);
-    if (iterator == players_.end())
+    Player* neutralPlayer = getNeutralPlayer();
+    if (neutralPlayer == nullptr)
     {
-        Player* neutralPlayer = new Player();
+        neutralPlayer = new Player();
+        neutralPlayer->setId(context_->playersById.size());
         neutralPlayer->addOwnedTerritory(territory);
-        players_.push_back(neutralPlayer);
+        context_->players.push_back(neutralPlayer);
+        context_->playersById.push_back(neutralPlayer);
+        context_->diplomacy.resize(context_->playersById.size());
+        context_->neutralPlayer = neutralPlayer;
     }
     else
     {
-        Player* neutralPlayer = *iterator;
         neutralPlayer->addOwnedTerritory(territory);
     }
 }
@@ -308,16 +506,21 @@ void GameEngine::assignToNeutralPlayer(Territory* territory)
 // Deallocate static members of GameEngine class
 void GameEngine::resetGameEngine()
 {
-    delete deck_;
-    delete map_;
-    deck_ = nullptr;
-    map_ = nullptr;
-
-    for (const auto &player : players_)
+    delete context_->deck;
+    delete context_->map;
+    delete context_->recorder;
+    context_->deck = nullptr;
+    context_->map = nullptr;
+    context_->recorder = nullptr;
+
+    for (const auto &player : context_->players)
     {
         delete player;
     }
-    players_.clear();
+    context_->players.clear();
+    context_->playersById.clear();
+    context_->diplomacy.clear();
+    context_->neutralPlayer = nullptr;
 }
 
 // Setup the map and players to be included in the game based on the user's input
@@ -330,99 +533,152 @@ void GameEngine::startGame()
     setMap(selectMap());
     std::cout << std::endl;
 
-    players_ = setupPlayers();
+    setPlayers(setupPlayers(context_->map));
     std::cout << std::endl;
 
     setupObservers(this);
 
-    deck_->generateCards(50);
+    context_->deck->generateCards(50);
 }
 
 // Goes through the startup phase of the game where:
 // - Order of the players is determined at random
-// - Territories are assigned to each player at random
+// - Territories are assigned to each player by the distributor (at random by default)
+// - Players who were dealt no territory, when there are more players than territories, are eliminated
 // - A base number of armies are assigned to each player
 void GameEngine::startupPhase()
 {
     currentPhase_ = STARTUP;
-    notify();
+    if (hasSubscribers<PhaseChanged>())
+    {
+        publish(describeTurn(STARTUP, nullptr));
+    }
+    PROFILE_RESET();
+    ALLOCATION_SCOPE(STARTUP_TAG);
+    round_ = 0;
+    ordersExecuted_ = 0;
+    endReason_ = GAME_IN_PROGRESS;
+
+    // Shuffle the order of players in the game. The territories are dealt from the same generator.
+    std::mt19937 random(context_->seed);
+    shuffle(context_->players.begin(), context_->players.end(), random);
+    for (size_t i = 0; i < context_->players.size(); i++)
+    {
+        context_->players.at(i)->setSeed(context_->seed + i);
+    }
+    context_->deck->setSeed(context_->seed);
 
-    // Shuffle the order of players in the game
-    shuffle(players_.begin(), players_.end(), std::default_random_engine(time(nullptr)));
+    if (context_->recorder != nullptr)
+    {
+        context_->recorder->recordGameStart(context_->seed, context_->map, context_->players);
+        context_->recorder->recordPhase(STARTUP);
+    }
 
     // Assign territories
-    int playerIndex = 0;
-    std::vector<Territory*> assignableTerritories = map_->getTerritories();
-    while (!assignableTerritories.empty())
+    for (const auto &assignment : distributor_.distribute(context_->map, context_->players.size(), random))
     {
-        // Pop out a random territory
-        int randomIndex = rand() % assignableTerritories.size();
-        Territory* randomTerritory = assignableTerritories.at(randomIndex);
-        assignableTerritories.erase(assignableTerritories.begin() + randomIndex);
-
-        players_.at(playerIndex)->addOwnedTerritory(randomTerritory);
-        playerIndex = (playerIndex + 1) % players_.size();
+        context_->players.at(assignment.player)->addOwnedTerritory(assignment.territory);
     }
+    removeEliminatedPlayers_();
 
-    const int NUMBER_OF_INITIAL_ARMIES = (-5 * players_.size()) + 50;
-    for (auto &player : players_)
+    // Fewer armies the more players there are, down to none from 10 players on
+    const int NUMBER_OF_INITIAL_ARMIES = std::max(50 - 5 * (int)context_->players.size(), 0);
+    for (auto &player : context_->players)
     {
         player->addReinforcements(NUMBER_OF_INITIAL_ARMIES);
     }
+
+    stalemateDetector_.startGame(context_->map->getTerritories(), context_->players);
 }
 
 // Assigns the appropriate amount of reinforcements for each player based on the territories they control.
 void GameEngine::reinforcementPhase()
 {
-    for (auto &player : players_)
+    PROFILE_SCOPE(REINFORCEMENT_SECTION);
+    PROFILE_COUNT(ROUNDS_COUNTER);
+    TRACE_SCOPE("Reinforcement phase", "phase");
+    ALLOCATION_SCOPE(REINFORCEMENT_TAG);
+
+    if (context_->recorder != nullptr)
+    {
+        context_->recorder->recordRoundStart();
+        context_->recorder->recordPhase(REINFORCEMENT);
+    }
+
+    // Find who owns all members of each continent, in one pass over the territories. A continent without members
+    // counts as owned by every player.
+    std::unordered_map<Player*, int> continentBonuses;
+    int bonusForEveryone = 0;
+    for (const auto &continent : context_->map->getContinents())
     {
-        if (player->isNeutral())
+        std::vector<Territory*> continentMembers = continent->getTerritories();
+        if (continentMembers.empty())
         {
+            bonusForEveryone += continent->getControlValue();
             continue;
         }
 
-        activePlayer_ = player;
-
-        std::vector<Territory*> playerTerritories = player->getOwnedTerritories();
-        int reinforcements = floor(playerTerritories.size() / 3);
-    
-        // Check if the player owns all members of any continents
-        for (const auto &continent : map_->getContinents())
+        Player* owner = continentMembers.front()->getOwner();
+        auto isOwnedByOwner = [owner](const auto &member) { return member->getOwner() == owner; };
+        if (owner != nullptr && all_of(continentMembers.begin(), continentMembers.end(), isOwnedByOwner))
         {
-            int numberOfContinentMembersOwned = 0;
-            std::vector<Territory*> continentMembers = continent->getTerritories();
-            for (const auto &member : continentMembers)
-            {
-                if (find(playerTerritories.begin(), playerTerritories.end(), member) != playerTerritories.end())
-                {
-                    numberOfContinentMembersOwned++;
-                }
-            }
+            continentBonuses[owner] += continent->getControlValue();
+        }
+    }
 
-            if (numberOfContinentMembersOwned == continentMembers.size())
-            {
-                reinforcements += continent->getControlValue();
-            }
+    Player* neutralPlayer = getNeutralPlayer();
+    for (auto &player : context_->players)
+    {
+        if (player == neutralPlayer)
+        {
+            continue;
         }
 
+        activePlayer_ = player;
+
+        int reinforcements = floor(player->getNumberOfOwnedTerritories() / 3);
+    
+        // Add the control value of the continents the player owns all members of
+        auto bonus = continentBonuses.find(player);
+        reinforcements += bonusForEveryone + (bonus == continentBonuses.end() ? 0 : bonus->second);
+
         if (reinforcements < 3)
         {
             reinforcements = 3;
         }
 
         player->addReinforcements(reinforcements);
-        notify();
-        std::cout << "[" << player->getName() << "] received " << reinforcements << " reinforcements and now has " << player->getReinforcements() << " in total." << std::endl;
+        if (hasSubscribers<PhaseChanged>())
+        {
+            publish(describeTurn(REINFORCEMENT, player));
+        }
+        LOG_INFO("[" << player->getName() << "] received " << reinforcements << " reinforcements and now has " << player->getReinforcements() << " in total.\n");
     }
 }
 
 // Issue orders one-by-one in a round-robin fashion over all the players
 void GameEngine::issueOrdersPhase()
 {
+    PROFILE_SCOPE(ISSUE_ORDERS_SECTION);
+    TRACE_SCOPE("Issue orders phase", "phase");
+    ALLOCATION_SCOPE(ISSUE_ORDERS_TAG);
+
+    if (context_->recorder != nullptr)
+    {
+        context_->recorder->recordPhase(ISSUE_ORDERS);
+    }
+
+    bool humanInGame = any_of(context_->players.begin(), context_->players.end(), [](auto player) { return player->isHuman(); });
+    if (concurrentIssuing_ && !humanInGame)
+    {
+        issueOrdersConcurrently_();
+        return;
+    }
+
     std::unordered_set<Player*> playersFinishedIssuingOrders;
-    while (playersFinishedIssuingOrders.size() != players_.size())
+    while (playersFinishedIssuingOrders.size() != context_->players.size())
     {
-        for (auto &player : players_)
+        for (auto &player : context_->players)
         {
             activePlayer_ = player;
 
@@ -432,19 +688,137 @@ void GameEngine::issueOrdersPhase()
                 continue;                
             }
 
-            notify();
-            std::cout << "[" << player->getName() << "] ";
+            TRACE_SCOPE_DETAIL("Turn", "turn", player->getName());
+            if (hasSubscribers<PhaseChanged>())
+            {
+                publish(describeTurn(ISSUE_ORDERS, player));
+            }
+            LOG_INFO("[" << player->getName() << "] ");
             player->issueOrder();
         }
     }
 }
 
+// Issue orders like issueOrdersPhase(), awaiting the turns of players who answer asynchronously (e.g. RemotePlayerStrategy).
+// Games without such players issue their orders through issueOrdersPhase(). The phase is not profiled as a whole here, as
+// it may continue on another thread after every turn.
+GameTask GameEngine::issueOrdersPhaseAsync()
+{
+    // The context of the game is kept aside, as the phase may continue on another thread
+    GameContext* context = context_;
+    bool remoteInGame = any_of(context->players.begin(), context->players.end(), [](auto player) { return player->isRemote(); });
+    if (!remoteInGame)
+    {
+        issueOrdersPhase();
+        co_return;
+    }
+
+    if (context->recorder != nullptr)
+    {
+        context->recorder->recordPhase(ISSUE_ORDERS);
+    }
+
+    std::unordered_set<Player*> playersFinishedIssuingOrders;
+    while (playersFinishedIssuingOrders.size() != context->players.size())
+    {
+        for (auto &player : context->players)
+        {
+            activePlayer_ = player;
+
+            if (player->isDoneIssuingOrders())
+            {
+                playersFinishedIssuingOrders.insert(player);
+                continue;
+            }
+
+            if (hasSubscribers<PhaseChanged>())
+            {
+                publish(describeTurn(ISSUE_ORDERS, player));
+            }
+            LOG_INFO("[" << player->getName() << "] ");
+            co_await player->issueOrderAsync();
+        }
+    }
+}
+
+// Lets every AI player issue all of its orders on a thread of its own. AI players only read the state of the game as of
+// the start of the phase, so they can all issue at once. Their turns are then published in the same round-robin order as
+// in issueOrdersPhase(), each with what the player had as the turn started, so that the deck, the recording and the
+// observers see the same sequence of turns.
+void GameEngine::issueOrdersConcurrently_()
+{
+    std::vector<Player*> playersIssuingOrders;
+    for (const auto &player : context_->players)
+    {
+        if (!player->isDoneIssuingOrders())
+        {
+            playersIssuingOrders.push_back(player);
+        }
+    }
+    if (playersIssuingOrders.empty())
+    {
+        return;
+    }
+
+    // Players are handed out from a shared counter to as many threads as there are cores, this thread included, so that
+    // games with hundreds of players do not start a thread per player and single-core machines start none. The other
+    // threads play in the context of this game.
+    GameContext* context = context_;
+    std::atomic<int> nextPlayer = 0;
+    auto issueTurns = [&playersIssuingOrders, &nextPlayer, context]() {
+        setContext(context);
+        ALLOCATION_SCOPE(ISSUE_ORDERS_TAG);
+        for (int i = nextPlayer++; i < static_cast<int>(playersIssuingOrders.size()); i = nextPlayer++)
+        {
+            TRACE_SCOPE_DETAIL("Turn", "turn", playersIssuingOrders.at(i)->getName());
+            playersIssuingOrders.at(i)->issueAllOrders();
+        }
+    };
+
+    int numberOfThreads = std::min<int>(playersIssuingOrders.size(), std::max<int>(std::thread::hardware_concurrency(), 1));
+    std::vector<std::future<void>> issuing;
+    for (int i = 1; i < numberOfThreads; i++)
+    {
+        issuing.push_back(std::async(std::launch::async, issueTurns));
+    }
+    issueTurns();
+    for (auto &thread : issuing)
+    {
+        thread.get();
+    }
+
+    bool turnPublished = true;
+    for (int turn = 0; turnPublished; turn++)
+    {
+        turnPublished = false;
+        for (const auto &player : playersIssuingOrders)
+        {
+            if (player->publishIssuedTurn(turn))
+            {
+                activePlayer_ = player;
+                if (hasSubscribers<PhaseChanged>())
+                {
+                    publish(describeTurn(ISSUE_ORDERS, player, player->getIssuedTurnSnapshot(turn)));
+                }
+                turnPublished = true;
+            }
+        }
+    }
+}
+
 // Executes players' orders in a round-robin fashion until all players have no orders left to execute.
 void GameEngine::executeOrdersPhase()
 {
-    std::vector<Player*> playersInTurn = players_;
-    std::unordered_set<Player*> playersFinishedDeploying;
-    std::unordered_set<Player*> playersFinishedExecutingOrders;
+    PROFILE_SCOPE(EXECUTE_ORDERS_SECTION);
+    TRACE_SCOPE("Execute orders phase", "phase");
+    ALLOCATION_SCOPE(EXECUTE_ORDERS_TAG);
+
+    std::vector<Player*> playersInTurn = context_->players;
+
+    if (context_->recorder != nullptr)
+    {
+        context_->recorder->recordPhase(EXECUTE_ORDERS);
+    }
 
     // ====== PRE-EXECUTION ======
     // Take a snapshot of the players' owned territories before proceeding with the order executions
@@ -455,42 +829,78 @@ void GameEngine::executeOrdersPhase()
     }
 
     // ====== EXECUTION ======
-    while (playersFinishedExecutingOrders.size() != playersInTurn.size())
+    // The orders are executed in the sequence scheduled up front, and deleted along with the schedule. They are only
+    // executed in parallel if some batch of them is worth handing out to the execution threads.
+    ExecutionSchedule schedule(playersInTurn);
+    std::vector<std::vector<int>> batches;
+    int minimumBatchSize = getMinimumParallelBatchSize_();
+    if (executionPool_ != nullptr && context_->recorder == nullptr && minimumBatchSize != NO_PARALLEL_BATCH)
+    {
+        batches = schedule.getBatches();
+    }
+    bool parallel = any_of(batches.begin(), batches.end(), [minimumBatchSize](const auto &batch) {
+        return static_cast<int>(batch.size()) >= minimumBatchSize;
+    });
+
+    if (parallel)
+    {
+        executeOrdersInParallel_(schedule, batches, minimumBatchSize);
+    }
+    else
     {
-        for (auto &player : playersInTurn)
+        auto start = std::chrono::steady_clock::now();
+        for (const auto &step : schedule.getSteps())
         {
+            Player* player = step.player;
             activePlayer_ = player;
-            Order* order = player->peekNextOrder();
 
-            // Current player still has orders to execute
-            if (order != nullptr)
+            // Current player has no orders left to execute this turn
+            if (step.order == nullptr)
             {
-                // Ignore non-deploy orders until everyone has finished executing their deployments
-                if (order->getType() != DEPLOY && playersFinishedDeploying.size() != playersInTurn.size())
-                {
-                    playersFinishedDeploying.insert(player);
-                    continue;
-                }
-
-                // Notify for phase observer
-                notify();
+                player->endTurn();
+                continue;
+            }
 
-                order = player->getNextOrder();
-                std::cout << "[" << player->getName() << "] ";
-                order->execute();
-                delete order;
-                order = nullptr;
+            TRACE_SCOPE_DETAIL("Turn", "turn", player->getName());
+            if (hasSubscribers<PhaseChanged>())
+            {
+                TurnSnapshot snapshot = player->getTurnSnapshot();
+                snapshot.orders = step.ordersLeft;
+                publish(describeTurn(EXECUTE_ORDERS, player, snapshot));
+            }
 
-                // Notify for game statistics observer
-                notify();
+            // Owners of the territories the order may capture, if anyone listens for captures
+            std::vector<Territory*> affectedTerritories = step.order->getAffectedTerritories();
+            std::vector<Player*> previousOwners;
+            if (hasSubscribers<TerritoryCaptured>())
+            {
+                for (const auto &territory : affectedTerritories)
+                {
+                    previousOwners.push_back(getOwnerOf(territory));
+                }
             }
-            // Current player has no orders left to execute this turn
-            else
+
+            LOG_INFO("[" << player->getName() << "] ");
+            step.order->execute();
+            for (size_t i = 0; i < affectedTerritories.size(); i++)
             {
-                player->endTurn();
-                playersFinishedExecutingOrders.insert(player);
-                playersFinishedDeploying.insert(player);
+                Territory* territory = affectedTerritories.at(i);
+                stalemateDetector_.updateTerritory(territory, getOwnerOf(territory));
+                if (!previousOwners.empty() && previousOwners.at(i) != getOwnerOf(territory))
+                {
+                    publish(TerritoryCaptured{ territory, previousOwners.at(i), getOwnerOf(territory) });
+                }
             }
+            ordersExecuted_++;
+            publish(OrderExecuted{ player, step.order });
+        }
+
+        // Keep a running estimate of the time a step takes, for getMinimumParallelBatchSize_()
+        if (!schedule.getSteps().empty())
+        {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            double stepSeconds = seconds / schedule.getSteps().size();
+            stepSeconds_ = stepSeconds_ == 0 ? stepSeconds : (3 * stepSeconds_ + stepSeconds) / 4;
         }
     }
 
@@ -502,60 +912,324 @@ void GameEngine::executeOrdersPhase()
         std::vector<Territory*> postExecuteTerritories = player->getOwnedTerritories();
         if (preExecuteTerritories.size() <= postExecuteTerritories.size() && preExecuteTerritories != postExecuteTerritories)
         {
-            player->drawCardFromDeck();
+            const Card* card = player->drawCardFromDeck();
+            if (card != nullptr)
+            {
+                publish(CardDrawn{ player, card });
+            }
+        }
+    }
+
+    if (context_->recorder != nullptr)
+    {
+        context_->recorder->recordRoundEnd();
+    }
+}
+
+// Smallest batch of orders worth handing out to the execution threads. Handing out a batch of n steps to t cores takes
+// about dispatch + n * step / t instead of n * step, so it pays off once n * step * (1 - 1 / t) exceeds the dispatch time.
+// Batches are never handed out without a second core, or before a round has been executed sequentially to time a step.
+int GameEngine::getMinimumParallelBatchSize_() const
+{
+    if (executionPool_ == nullptr)
+    {
+        return NO_PARALLEL_BATCH;
+    }
+    if (minimumParallelBatchSize_ > 0)
+    {
+        return minimumParallelBatchSize_;
+    }
+
+    // Asking for the number of cores reads it from the system, which would cost more than a small round
+    static const int HARDWARE_CORES = std::thread::hardware_concurrency();
+    int cores = std::min(executionPool_->getNumberOfThreads(), HARDWARE_CORES);
+    if (cores < 2 || stepSeconds_ == 0)
+    {
+        return NO_PARALLEL_BATCH;
+    }
+
+    double minimumBatchSize = executionPool_->getDispatchSeconds() / (stepSeconds_ * (1 - 1.0 / cores));
+    return minimumBatchSize >= NO_PARALLEL_BATCH ? NO_PARALLEL_BATCH : std::max<int>(ceil(minimumBatchSize), cores);
+}
+
+// Executes the batches of the schedule one after the other, spreading the steps of the batches of at least
+// `minimumBatchSize` steps over the execution threads. While a batch executes, territories changing hands are kept aside, as every order may look up the owner of a
+// territory. They are applied in the order of the schedule once the batch is done, and the players'
+// lists are sorted back in the order of the schedule at the end. Events are published in the order of the schedule once
+// the batch is done, and so are the players' territories ordered by strength. What each step logs is kept aside and
+// written out in the order of the schedule once every step before it has executed, so the log reads as if the orders had
+// been executed one at a time.
+void GameEngine::executeOrdersInParallel_(const ExecutionSchedule &schedule, const std::vector<std::vector<int>> &batches,
+                                          int minimumBatchSize)
+{
+    const std::vector<ScheduledStep> &steps = schedule.getSteps();
+    std::unordered_map<Territory*, int> captureIndices;
+    GameContext* context = context_;
+
+    // Steps left out of the batches have nothing to log
+    std::vector<std::string> stepLogs(steps.size());
+    std::vector<bool> stepsExecuted(steps.size(), true);
+    for (const auto &batch : batches)
+    {
+        for (const auto &index : batch)
+        {
+            stepsExecuted.at(index) = false;
+        }
+    }
+    size_t nextStepLog = 0;
+
+    for (const auto &batch : batches)
+    {
+        std::vector<std::vector<OwnershipChange>> ownershipChanges(batch.size());
+        auto executeStep = [&steps, &batch, &ownershipChanges, &stepLogs, context](int i) {
+            const ScheduledStep &step = steps.at(batch.at(i));
+            setContext(context);
+            Player::deferOwnershipChanges(&ownershipChanges.at(i));
+            Logger::deferOutput(&stepLogs.at(batch.at(i)));
+            if (step.order == nullptr)
+            {
+                step.player->endTurn();
+            }
+            else
+            {
+                LOG_INFO("[" << step.player->getName() << "] ");
+                step.order->execute();
+            }
+            Logger::deferOutput(nullptr);
+            Player::deferOwnershipChanges(nullptr);
+        };
+
+        if (static_cast<int>(batch.size()) < minimumBatchSize)
+        {
+            for (size_t i = 0; i < batch.size(); i++)
+            {
+                executeStep(i);
+            }
+        }
+        else
+        {
+            executionPool_->run(batch.size(), executeStep);
+        }
+
+        for (size_t i = 0; i < batch.size(); i++)
+        {
+            std::vector<TerritoryCaptured> captures;
+            for (const auto &change : ownershipChanges.at(i))
+            {
+                if (change.added)
+                {
+                    captureIndices[change.territory] = batch.at(i);
+                    if (hasSubscribers<TerritoryCaptured>())
+                    {
+                        captures.push_back({ change.territory, getOwnerOf(change.territory), change.player });
+                    }
+                }
+            }
+            Player::applyOwnershipChanges(ownershipChanges.at(i));
+            for (const auto &capture : captures)
+            {
+                publish(capture);
+            }
+
+            const ScheduledStep &step = steps.at(batch.at(i));
+            if (step.order != nullptr)
+            {
+                for (const auto &territory : step.order->getAffectedTerritories())
+                {
+                    Player* owner = getOwnerOf(territory);
+                    stalemateDetector_.updateTerritory(territory, owner);
+                    if (owner != nullptr)
+                    {
+                        owner->updateTerritoryStrength(territory);
+                    }
+                }
+                ordersExecuted_++;
+                publish(OrderExecuted{ step.player, step.order });
+            }
+            stepsExecuted.at(batch.at(i)) = true;
+        }
+
+        for (; nextStepLog < steps.size() && stepsExecuted.at(nextStepLog); nextStepLog++)
+        {
+            Logger::write(stepLogs.at(nextStepLog));
+            stepLogs.at(nextStepLog).clear();
         }
+
+        activePlayer_ = steps.at(batch.back()).player;
+        if (hasSubscribers<PhaseChanged>())
+        {
+            TurnSnapshot snapshot = activePlayer_->getTurnSnapshot();
+            snapshot.orders = steps.at(batch.back()).ordersLeft;
+            publish(describeTurn(EXECUTE_ORDERS, activePlayer_, snapshot));
+        }
+    }
+
+    for (const auto &player : context_->players)
+    {
+        player->sortCapturedTerritories(captureIndices);
+    }
+}
+
+// Play a full round without pausing between the phases. Returns `false` once the game has been won or is a draw.
+bool GameEngine::playRound()
+{
+    round_++;
+    TRACE_SCOPE_DETAIL("Round", "round", std::to_string(round_));
+
+    currentPhase_ = REINFORCEMENT;
+    reinforcementPhase();
+
+    currentPhase_ = ISSUE_ORDERS;
+    issueOrdersPhase();
+
+    currentPhase_ = EXECUTE_ORDERS;
+    executeOrdersPhase();
+
+    currentPhase_ = NONE;
+    bool shouldContinueGame = endRound_();
+    if (hasSubscribers<PhaseChanged>())
+    {
+        publish(describeTurn(NONE, activePlayer_));
+    }
+
+    return shouldContinueGame;
+}
+
+// Play rounds like playRound() until the game has been won or is a draw, suspending while players' input is awaited.
+// Rounds are not traced, as a round may start and end on different threads.
+GameTask GameEngine::playGameAsync()
+{
+    GameContext* context = context_;
+    bool shouldContinueGame = true;
+    while (shouldContinueGame)
+    {
+        round_++;
+
+        currentPhase_ = REINFORCEMENT;
+        reinforcementPhase();
+
+        currentPhase_ = ISSUE_ORDERS;
+        co_await issueOrdersPhaseAsync();
+
+        currentPhase_ = EXECUTE_ORDERS;
+        executeOrdersPhase();
+
+        currentPhase_ = NONE;
+        shouldContinueGame = endRound_();
+        if (hasSubscribers<PhaseChanged>())
+        {
+            publish(describeTurn(NONE, activePlayer_));
+        }
+    }
+
+    if (context->recorder != nullptr)
+    {
+        context->recorder->recordGameEnd();
     }
 }
 
 // Core game loop
 void GameEngine::mainGameLoop()
 {
-    int round = 0;
     bool shouldContinueGame = true;
     while (shouldContinueGame)
     {
-        pause();
-        std::cout << "\n================================================= ROUND " << ++round << " =====================================================" << std::endl;
+        round_++;
+        TRACE_SCOPE_DETAIL("Round", "round", std::to_string(round_));
+
+        waitForEnter();
+        LOG_INFO("\n================================================= ROUND " << round_ << " =====================================================\n");
         currentPhase_ = REINFORCEMENT;
         reinforcementPhase();
 
-        pause();
-        std::cout << "\n=====================================================================================================================" << std::endl;
+        waitForEnter();
+        LOG_INFO("\n=====================================================================================================================\n");
         currentPhase_ = ISSUE_ORDERS;
         issueOrdersPhase();
 
-        pause();
-        std::cout << "\n=====================================================================================================================" << std::endl;
+        waitForEnter();
+        LOG_INFO("\n=====================================================================================================================\n");
         currentPhase_ = EXECUTE_ORDERS;
         executeOrdersPhase();
 
         currentPhase_ = NONE;
+        shouldContinueGame = endRound_();
+        if (hasSubscribers<PhaseChanged>())
+        {
+            publish(describeTurn(NONE, activePlayer_));
+        }
+    }
+
+    if (context_->recorder != nullptr)
+    {
+        context_->recorder->recordGameEnd();
+    }
+
+    LOG_INFO("Total rounds played: " << round_ << "\n");
+    PROFILE_REPORT();
+}
+
+// Check whether the game is over at the end of a round.
+// Returns `false` if a player owns every territory or the game can no longer be won.
+bool GameEngine::endRound_()
+{
+    if (!removeEliminatedPlayers_())
+    {
+        endReason_ = CONQUEST;
+        return false;
+    }
 
-        // Check for any winner and remove players who do not own any territories
-        for (auto &player : players_)
+    endReason_ = stalemateDetector_.endRound(round_);
+    if (endReason_ != GAME_IN_PROGRESS)
+    {
+        LOG_INFO("The game is a draw after " << round_ << " rounds: " << StalemateDetector::getReasonName(endReason_) << "\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Check for any winner and remove players who do not own any territories.
+// Returns `false` if a player owns every territory.
+bool GameEngine::removeEliminatedPlayers_()
+{
+    bool shouldContinueGame = true;
+    for (auto &player : context_->players)
+    {
+        if (player->getNumberOfOwnedTerritories() == context_->map->getNumberOfTerritories())
+        {
+            shouldContinueGame = false;
+        }
+                    
+        if (player->getNumberOfOwnedTerritories() == 0)
         {
-            if (player->getOwnedTerritories().size() == map_->getAdjacencyList().size())
+            if (player == activePlayer_)
             {
-                shouldContinueGame = false;
+                activePlayer_ = nullptr;
             }
-                        
-            if (player->getOwnedTerritories().size() == 0)
+
+            if (context_->recorder != nullptr)
             {
-                if (player == activePlayer_)
-                {
-                    activePlayer_ = nullptr;
-                }
+                context_->recorder->recordPlayerEliminated(player);
+            }
 
-                delete player;
-                player = nullptr;
+            stalemateDetector_.removePlayer(player);
+            publish(PlayerEliminated{ player });
+            if (getPlayer(player->getId()) == player)
+            {
+                context_->playersById.at(player->getId()) = nullptr;
             }
+            if (player == context_->neutralPlayer)
+            {
+                context_->neutralPlayer = nullptr;
+            }
+            delete player;
+            player = nullptr;
         }
-
-        auto removeIterator = remove_if(players_.begin(), players_.end(), [](const auto &p) { return p == nullptr; });
-        players_.erase(removeIterator, players_.end());
-
-        notify();
     }
 
-    std::cout << "Total rounds played: " << round << std::endl;
+    auto removeIterator = remove_if(context_->players.begin(), context_->players.end(), [](const auto &p) { return p == nullptr; });
+    context_->players.erase(removeIterator, context_->players.end());
+
+    return shouldContinueGame;
 }
@@ -4,9 +4,37 @@
 #include "../map/Map.h"
 #include "../observers/GameObservers.h"
 #include "../player/Player.h"
+#include "DiplomacyMatrix.h"
+#include "GameTask.h"
+#include "StalemateDetector.h"
+#include "TerritoryDistributor.h"
 #include <iostream>
 #include <vector>
 
+class ExecutionSchedule;
+class GameRecorder;
+class WorkerPool;
+
+// State of one game that the static members of GameEngine give access to. Each thread works on the context installed with
+// GameEngine::setContext(), so that a GameScheduler can play many games on the same threads.
+struct GameContext
+{
+    Deck* deck;
+    Map* map;
+    std::vector<Player*> players;
+    GameRecorder* recorder;
+    unsigned int seed;
+
+    // Players by id, including the neutral player once it joins. Eliminated players are set to nullptr.
+    std::vector<Player*> playersById;
+
+    // Who negotiated with whom this turn, by player id
+    DiplomacyMatrix diplomacy;
+
+    // The Neutral Player, cached when it joins the game. nullptr if there is none.
+    Player* neutralPlayer;
+};
+
 class GameEngine : public Subject
 {
 public:
@@ -17,25 +45,62 @@ public:
     static Deck* getDeck();
     static Map* getMap();
     static std::vector<Player*> getPlayers();
+    static Player* getPlayer(PlayerId id);
+    static Territory* getTerritory(TerritoryId id);
     static Player* getOwnerOf(Territory* territory);
+    static Player* getNeutralPlayer();
+    static DiplomacyMatrix* getDiplomacy();
+    static GameRecorder* getRecorder();
+    static unsigned int getSeed();
+    static GameContext* getContext();
+    static bool isIssuingConcurrently();
+    static int getExecutionThreads();
+    static void setDeck(Deck* deck);
     static void setMap(Map* map);
     static void setPlayers(std::vector<Player*> players);
+    static void setRecorder(GameRecorder* recorder);
+    static void setSeed(unsigned int seed);
+    static void setContext(GameContext* context);
+    static void setConcurrentIssuing(bool concurrentIssuing);
+    static void setExecutionThreads(int numberOfThreads);
+    static void setMinimumParallelBatchSize(int minimumBatchSize);
     static void assignToNeutralPlayer(Territory* territory);
     static void resetGameEngine();
     Phase getPhase() const;
     Player* getActivePlayer() const;
+    int getRound() const;
+    long getNumberOfOrdersExecuted() const;
+    GameEndReason getEndReason() const;
+    StalemateDetector &getStalemateDetector();
+    TerritoryDistributor &getDistributor();
     std::vector<Player*> getCurrentPlayers() const;
     void startGame();
     void startupPhase();
     void reinforcementPhase();
     void issueOrdersPhase();
     void executeOrdersPhase();
+    GameTask issueOrdersPhaseAsync();
+    bool playRound();
+    GameTask playGameAsync();
     void mainGameLoop();
 
 private:
-    static Deck* deck_;
-    static Map* map_;
-    static std::vector<Player*> players_;
+    static GameContext defaultContext_;
+    static thread_local GameContext* context_;
+    static bool concurrentIssuing_;
+    static WorkerPool* executionPool_;
+    static int minimumParallelBatchSize_;
     Phase currentPhase_;
     Player* activePlayer_;
+    int round_;
+    long ordersExecuted_;
+    GameEndReason endReason_;
+    double stepSeconds_;
+    StalemateDetector stalemateDetector_;
+    TerritoryDistributor distributor_;
+    void issueOrdersConcurrently_();
+    int getMinimumParallelBatchSize_() const;
+    void executeOrdersInParallel_(const ExecutionSchedule &schedule, const std::vector<std::vector<int>> &batches, int minimumBatchSize);
+    bool endRound_();
+    bool removeEliminatedPlayers_();
 };
@@ -43,7 +43,7 @@ int main()
     {
         std::cout << *player << std::endl;
         std::vector<Territory*> playerTerritories = player->getOwnedTerritories();
-        for (int i = 0; i < playerTerritories.size(); i++)
+        for (size_t i = 0; i < playerTerritories.size(); i++)
         {
             std::cout << (i+1) << ". " << playerTerritories.at(i)->getName() << std::endl;
         }
@@ -0,0 +1,322 @@
+#include "GameScheduler.h"
+#include <thread>
+#include <utility>
+
+
+// Initialize static members
+thread_local GameSession* GameScheduler::currentSession_ = nullptr;
+
+
+/*
+===================================
+ Implementation for InputChannel class
+===================================
+ */
+
+// Constructor. `promptHandler` is called on the game's thread with every prompt, and must not block.
+InputChannel::InputChannel(std::function<void(InputChannel* channel, const std::string &prompt)> promptHandler)
+    : promptHandler_(promptHandler), waitingAwaiter_(nullptr), waitingCoroutine_(nullptr) {}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const InputChannel &channel)
+{
+    std::lock_guard<std::mutex> lock(channel.mutex_);
+    output << "[InputChannel] " << channel.lines_.size() << " lines pending, " << (channel.waitingCoroutine_ ? "awaited" : "not awaited");
+    return output;
+}
+
+// Send `text` to the client
+void InputChannel::prompt(const std::string &text)
+{
+    promptHandler_(this, text);
+}
+
+// Hand a line to the game. If the game is waiting for it, the game is scheduled to continue.
+void InputChannel::push(const std::string &line)
+{
+    GameSession* session = nullptr;
+    std::coroutine_handle<> coroutine = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (waitingAwaiter_ == nullptr)
+        {
+            lines_.push_back(line);
+            return;
+        }
+
+        waitingAwaiter_->line_ = line;
+        session = waitingAwaiter_->session_;
+        coroutine = std::exchange(waitingCoroutine_, nullptr);
+        waitingAwaiter_ = nullptr;
+    }
+
+    session->wake(coroutine);
+}
+
+// Wait for the next line from the client. Must be awaited by a game played by a GameScheduler.
+InputChannel::LineAwaiter InputChannel::nextLine()
+{
+    GameSession* session = GameScheduler::getCurrentSession();
+    if (session == nullptr)
+    {
+        throw "Input can only be awaited by games played by a GameScheduler.";
+    }
+
+    return LineAwaiter(this, session);
+}
+
+
+/*
+===================================
+ Implementation for LineAwaiter class
+===================================
+ */
+
+// Constructor
+InputChannel::LineAwaiter::LineAwaiter(InputChannel* channel, GameSession* session) : channel_(channel), session_(session) {}
+
+// Take a line that is already there, or suspend until push() hands one over
+bool InputChannel::LineAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+bool InputChannel::LineAwaiter::await_suspend(std::coroutine_handle<> awaitingCoroutine)
+{
+    std::lock_guard<std::mutex> lock(channel_->mutex_);
+    if (!channel_->lines_.empty())
+    {
+        line_ = channel_->lines_.front();
+        channel_->lines_.pop_front();
+        return false;
+    }
+    if (channel_->waitingAwaiter_ != nullptr)
+    {
+        throw "Only one game at a time can wait for input on a channel.";
+    }
+
+    channel_->waitingAwaiter_ = this;
+    channel_->waitingCoroutine_ = awaitingCoroutine;
+    return true;
+}
+
+std::string InputChannel::LineAwaiter::await_resume()
+{
+    return std::move(line_);
+}
+
+
+/*
+===================================
+ Implementation for GameSession class
+===================================
+ */
+
+// Constructor. `setup` is called once the game starts, on a thread playing in the context of the game, and should set up the
+// deck, the map and the players through the static setters of GameEngine.
+GameSession::GameSession(std::function<void(GameEngine &gameEngine)> setup)
+    : setup_(setup), context_({ .deck = new Deck(), .map = new Map(), .players = {}, .recorder = nullptr, .seed = 0, .playersById = {}, .diplomacy = {}, .neutralPlayer = nullptr }), summary_({ 0, 0, GAME_IN_PROGRESS, 0 }),
+      scheduler_(nullptr), scheduled_(false), nextCoroutine_(nullptr)
+{
+    task_ = play_();
+}
+
+// Destructor
+GameSession::~GameSession()
+{
+    GameContext* previousContext = GameEngine::getContext();
+    GameEngine::setContext(&context_);
+    GameEngine::resetGameEngine();
+    GameEngine::setContext(previousContext);
+}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const GameSession &session)
+{
+    output << "[GameSession] Round " << session.gameEngine_.getRound() << ", " << session.task_;
+    return output;
+}
+
+// How the game ended. Only meaningful once the game is over.
+GameSummary GameSession::getSummary() const
+{
+    return summary_;
+}
+
+// Rethrow the exception that ended the game, if any
+void GameSession::rethrowIfFailed() const
+{
+    task_.rethrowIfFailed();
+}
+
+// Continue the game with `coroutine` on the next free thread. If the game is still running on a thread, that thread
+// continues it once the coroutine that was running has suspended.
+void GameSession::wake(std::coroutine_handle<> coroutine)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    nextCoroutine_ = coroutine;
+    if (!scheduled_)
+    {
+        scheduled_ = true;
+        scheduler_->schedule_(this);
+    }
+}
+
+// The whole game, from setup to cleanup
+GameTask GameSession::play_()
+{
+    setup_(gameEngine_);
+    gameEngine_.startupPhase();
+    co_await gameEngine_.playGameAsync();
+
+    summary_ = { gameEngine_.getRound(), gameEngine_.getNumberOfOrdersExecuted(), gameEngine_.getEndReason(),
+                 gameEngine_.getStalemateDetector().getHash() };
+    GameEngine::resetGameEngine();
+}
+
+// Run the game on the calling thread until it waits for input or is over. Returns `true` once it is over.
+bool GameSession::resume_()
+{
+    GameEngine::setContext(&context_);
+    GameScheduler::currentSession_ = this;
+
+    bool done = false;
+    while (true)
+    {
+        std::coroutine_handle<> coroutine = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            coroutine = std::exchange(nextCoroutine_, nullptr);
+            if (coroutine == nullptr)
+            {
+                done = task_.isDone();
+                scheduled_ = false;
+                break;
+            }
+        }
+
+        coroutine.resume();
+    }
+
+    GameScheduler::currentSession_ = nullptr;
+    GameEngine::setContext(nullptr);
+    return done;
+}
+
+
+/*
+===================================
+ Implementation for GameScheduler class
+===================================
+ */
+
+// Constructor. The thread calling run() counts as one of the `numberOfThreads`.
+GameScheduler::GameScheduler(int numberOfThreads) : numberOfThreads_(numberOfThreads), gamesLeft_(0) {}
+
+// Destructor
+GameScheduler::~GameScheduler()
+{
+    for (const auto &session : sessions_)
+    {
+        delete session;
+    }
+    sessions_.clear();
+}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const GameScheduler &scheduler)
+{
+    output << "[GameScheduler] " << scheduler.getNumberOfGames() << " games on " << scheduler.getNumberOfThreads() << " threads";
+    return output;
+}
+
+// Getters
+int GameScheduler::getNumberOfThreads() const
+{
+    return numberOfThreads_;
+}
+
+int GameScheduler::getNumberOfGames() const
+{
+    return sessions_.size();
+}
+
+// Game played on the calling thread, or nullptr if the thread is not playing a game for a GameScheduler
+GameSession* GameScheduler::getCurrentSession()
+{
+    return currentSession_;
+}
+
+// Add a game to play on the next call to run(). See GameSession::GameSession() for `setup`.
+void GameScheduler::addGame(std::function<void(GameEngine &gameEngine)> setup)
+{
+    GameSession* session = new GameSession(setup);
+    session->scheduler_ = this;
+    sessions_.push_back(session);
+}
+
+// Play all games added so far to their end, and return how they ended in the order they were added
+std::vector<GameSummary> GameScheduler::run()
+{
+    gamesLeft_ = sessions_.size();
+    for (const auto &session : sessions_)
+    {
+        session->wake(session->task_.getHandle());
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < numberOfThreads_; i++)
+    {
+        threads.emplace_back(&GameScheduler::work_, this);
+    }
+    work_();
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<GameSummary> summaries;
+    for (const auto &session : sessions_)
+    {
+        session->rethrowIfFailed();
+        summaries.push_back(session->getSummary());
+    }
+
+    return summaries;
+}
+
+// Queue a game to continue on the next free thread
+void GameScheduler::schedule_(GameSession* session)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        readySessions_.push_back(session);
+    }
+    sessionReady_.notify_one();
+}
+
+// Loop of the threads: continue games as they become ready, until every game is over
+void GameScheduler::work_()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        sessionReady_.wait(lock, [this]() { return gamesLeft_ == 0 || !readySessions_.empty(); });
+        if (gamesLeft_ == 0)
+        {
+            return;
+        }
+
+        GameSession* session = readySessions_.front();
+        readySessions_.pop_front();
+        lock.unlock();
+
+        bool gameOver = session->resume_();
+
+        lock.lock();
+        if (gameOver && --gamesLeft_ == 0)
+        {
+            sessionReady_.notify_all();
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "GameEngine.h"
+#include "GameTask.h"
+#include "StalemateDetector.h"
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class GameScheduler;
+class GameSession;
+
+// How a game played by a GameScheduler ended
+struct GameSummary
+{
+    int rounds;
+    long ordersExecuted;
+    GameEndReason endReason;
+    uint64_t hash;
+};
+
+
+// Lines of text exchanged with a player of a game played by a GameScheduler, e.g. a client playing over the network.
+// The game sends prompts to the client through the handler given on construction. The client answers from any thread
+// with push(), and the game awaits the answers with nextLine(), which frees its thread for other games in the meantime.
+class InputChannel
+{
+public:
+    // Awaitable for the next line pushed to the channel
+    class LineAwaiter
+    {
+    public:
+        LineAwaiter(InputChannel* channel, GameSession* session);
+        bool await_ready() const noexcept;
+        bool await_suspend(std::coroutine_handle<> awaitingCoroutine);
+        std::string await_resume();
+
+    private:
+        friend class InputChannel;
+        InputChannel* channel_;
+        GameSession* session_;
+        std::string line_;
+    };
+
+    InputChannel(std::function<void(InputChannel* channel, const std::string &prompt)> promptHandler);
+    InputChannel(const InputChannel &channel) = delete;
+    const InputChannel &operator=(const InputChannel &channel) = delete;
+    friend std::ostream &operator<<(std::ostream &output, const InputChannel &channel);
+    void prompt(const std::string &text);
+    void push(const std::string &line);
+    LineAwaiter nextLine();
+
+private:
+    std::function<void(InputChannel* channel, const std::string &prompt)> promptHandler_;
+    mutable std::mutex mutex_;
+    std::deque<std::string> lines_;
+    LineAwaiter* waitingAwaiter_;
+    std::coroutine_handle<> waitingCoroutine_;
+};
+
+
+// A game played by a GameScheduler: its context, its engine and the coroutine playing it.
+// A session is resumed by one thread at a time, which may be a different thread every time.
+class GameSession
+{
+public:
+    GameSession(std::function<void(GameEngine &gameEngine)> setup);
+    GameSession(const GameSession &session) = delete;
+    ~GameSession();
+    const GameSession &operator=(const GameSession &session) = delete;
+    friend std::ostream &operator<<(std::ostream &output, const GameSession &session);
+    GameSummary getSummary() const;
+    void rethrowIfFailed() const;
+    void wake(std::coroutine_handle<> coroutine);
+
+private:
+    friend class GameScheduler;
+    std::function<void(GameEngine &gameEngine)> setup_;
+    GameContext context_;
+    GameEngine gameEngine_;
+    GameSummary summary_;
+    GameTask task_;
+    GameScheduler* scheduler_;
+    std::mutex mutex_;
+    bool scheduled_;
+    std::coroutine_handle<> nextCoroutine_;
+    GameTask play_();
+    bool resume_();
+};
+
+
+// Plays many games on a small, fixed set of threads. A game holds on to a thread only while it has work to do: while it waits
+// for a player's input (see InputChannel), the thread moves on to other games, and the game continues on whichever thread is
+// free once the input arrives.
+class GameScheduler
+{
+public:
+    GameScheduler(int numberOfThreads);
+    GameScheduler(const GameScheduler &scheduler) = delete;
+    ~GameScheduler();
+    const GameScheduler &operator=(const GameScheduler &scheduler) = delete;
+    friend std::ostream &operator<<(std::ostream &output, const GameScheduler &scheduler);
+    int getNumberOfThreads() const;
+    int getNumberOfGames() const;
+    static GameSession* getCurrentSession();
+    void addGame(std::function<void(GameEngine &gameEngine)> setup);
+    std::vector<GameSummary> run();
+
+private:
+    friend class GameSession;
+    static thread_local GameSession* currentSession_;
+    int numberOfThreads_;
+    std::vector<GameSession*> sessions_;
+    std::mutex mutex_;
+    std::condition_variable sessionReady_;
+    std::deque<GameSession*> readySessions_;
+    int gamesLeft_;
+    void schedule_(GameSession* session);
+    void work_();
+};
@@ -0,0 +1,236 @@
+#include "GameEngine.h"
+#include "GameScheduler.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+namespace
+{
+    // Client answering the prompts of the remote players of every game from a thread of its own. Prompts are answered in
+    // batches after a short delay, standing in for the round trip to players over the network.
+    class RemoteClients
+    {
+    public:
+        RemoteClients() : stopping_(false), promptsAnswered_(0), largestBatch_(0), thread_(&RemoteClients::answer_, this) {}
+
+        ~RemoteClients()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            promptReady_.notify_one();
+            thread_.join();
+        }
+
+        void prompt(InputChannel* channel, const std::string &prompt)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                prompts_.push_back({ channel, prompt });
+            }
+            promptReady_.notify_one();
+        }
+
+        long getPromptsAnswered()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return promptsAnswered_;
+        }
+
+        size_t getLargestBatch()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return largestBatch_;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable promptReady_;
+        std::deque<std::pair<InputChannel*, std::string>> prompts_;
+        bool stopping_;
+        long promptsAnswered_;
+        size_t largestBatch_;
+        std::thread thread_;
+
+        void answer_()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true)
+            {
+                promptReady_.wait(lock, [this]() { return stopping_ || !prompts_.empty(); });
+                if (stopping_)
+                {
+                    return;
+                }
+
+                lock.unlock();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                lock.lock();
+
+                std::deque<std::pair<InputChannel*, std::string>> batch;
+                batch.swap(prompts_);
+                largestBatch_ = std::max(largestBatch_, batch.size());
+                promptsAnswered_ += batch.size();
+                lock.unlock();
+
+                for (const auto &prompt : batch)
+                {
+                    prompt.first->push(decide(prompt.second));
+                }
+                lock.lock();
+            }
+        }
+
+        // Deploy everything on the first territory, then advance the largest movable force to an enemy territory (or any
+        // neighbor if it has none) up to 4 times per turn
+        static std::string decide(const std::string &prompt)
+        {
+            std::istringstream lines(prompt);
+            std::string word;
+            int reinforcements = 0;
+            int orders = 0;
+            lines >> word >> reinforcements >> word >> orders;
+
+            std::vector<std::vector<int>> territories;
+            std::unordered_set<int> owned;
+            std::string line;
+            while (std::getline(lines, line))
+            {
+                std::istringstream fields(line);
+                std::vector<int> territory;
+                int value;
+                fields >> word;
+                while (fields >> value)
+                {
+                    territory.push_back(value);
+                }
+                if (territory.size() >= 3)
+                {
+                    owned.insert(territory.at(0));
+                    territories.push_back(territory);
+                }
+            }
+
+            if (reinforcements > 0 && !territories.empty())
+            {
+                return "deploy " + std::to_string(territories.front().at(0)) + " " + std::to_string(reinforcements);
+            }
+
+            auto byMovableArmies = [](const auto &t1, const auto &t2) { return t1.at(2) < t2.at(2); };
+            auto source = max_element(territories.begin(), territories.end(), byMovableArmies);
+            if (orders >= 4 || source == territories.end() || source->at(2) == 0 || source->size() == 3)
+            {
+                return "done";
+            }
+
+            int destination = source->at(3);
+            for (size_t i = 3; i < source->size(); i++)
+            {
+                if (owned.find(source->at(i)) == owned.end())
+                {
+                    destination = source->at(i);
+                    break;
+                }
+            }
+
+            return "advance " + std::to_string(source->at(0)) + " " + std::to_string(destination) + " " + std::to_string(source->at(2));
+        }
+    };
+
+    struct SchedulerResult
+    {
+        std::vector<GameSummary> summaries;
+        long promptsAnswered;
+        size_t largestBatch;
+        double seconds;
+    };
+
+    // Play `numberOfGames` games of a remote player against an Aggressive player on `numberOfThreads` threads
+    SchedulerResult playGames(int numberOfGames, int numberOfThreads)
+    {
+        MapGenerator generator(6, 6, 3);
+        RemoteClients clients;
+        std::vector<InputChannel*> channels;
+        GameScheduler scheduler(numberOfThreads);
+        for (int i = 0; i < numberOfGames; i++)
+        {
+            InputChannel* channel = new InputChannel([&clients](InputChannel* channel, const std::string &prompt) { clients.prompt(channel, prompt); });
+            channels.push_back(channel);
+            scheduler.addGame([&generator, channel, i](GameEngine &gameEngine) {
+                GameEngine::getDeck()->generateCards(50);
+                GameEngine::setMap(generator.generateMap());
+                GameEngine::setPlayers({
+                    new Player("Remote", new RemotePlayerStrategy(channel)),
+                    new Player("Aggressive", new AggressivePlayerStrategy())
+                });
+                GameEngine::setSeed(i);
+                gameEngine.getStalemateDetector().setMaximumRounds(50);
+            });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        SchedulerResult result = { scheduler.run(), 0, 0, 0 };
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.promptsAnswered = clients.getPromptsAnswered();
+        result.largestBatch = clients.getLargestBatch();
+
+        for (const auto &channel : channels)
+        {
+            delete channel;
+        }
+        return result;
+    }
+
+    bool isSameGame(const GameSummary &game1, const GameSummary &game2)
+    {
+        return game1.rounds == game2.rounds && game1.ordersExecuted == game2.ordersExecuted && game1.endReason == game2.endReason && game1.hash == game2.hash;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+
+    const int NUMBER_OF_GAMES = argc > 1 ? std::stoi(argv[1]) : 1000;
+    SchedulerResult oneThread = playGames(NUMBER_OF_GAMES, 1);
+    SchedulerResult fourThreads = playGames(NUMBER_OF_GAMES, 4);
+
+    int gamesMatching = 0;
+    int gamesFinished = 0;
+    long rounds = 0;
+    std::map<GameEndReason, int> endReasons;
+    for (int i = 0; i < NUMBER_OF_GAMES; i++)
+    {
+        const GameSummary &game = fourThreads.summaries.at(i);
+        gamesMatching += isSameGame(oneThread.summaries.at(i), game) ? 1 : 0;
+        gamesFinished += game.endReason != GAME_IN_PROGRESS ? 1 : 0;
+        rounds += game.rounds;
+        endReasons[game.endReason]++;
+    }
+
+    for (const auto &result : { std::make_pair(1, oneThread), std::make_pair(4, fourThreads) })
+    {
+        std::cout << NUMBER_OF_GAMES << " games on " << result.first << " thread" << (result.first == 1 ? "" : "s") << ": ";
+        std::cout << result.second.seconds << " s (" << NUMBER_OF_GAMES / result.second.seconds << " games/s), ";
+        std::cout << result.second.promptsAnswered << " prompts answered, up to " << result.second.largestBatch << " games waiting for input at once" << std::endl;
+    }
+    std::cout << gamesFinished << " games finished in " << rounds << " rounds (";
+    for (const auto &reason : endReasons)
+    {
+        std::cout << (reason == *endReasons.begin() ? "" : ", ") << reason.second << " " << StalemateDetector::getReasonName(reason.first);
+    }
+    std::cout << "), " << gamesMatching << " played the same on 1 and 4 threads" << std::endl;
+
+    return gamesFinished == NUMBER_OF_GAMES && gamesMatching == NUMBER_OF_GAMES ? 0 : 1;
+}
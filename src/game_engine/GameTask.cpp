@@ -0,0 +1,101 @@
+#include "GameTask.h"
+#include <utility>
+
+
+/*
+===================================
+ Implementation for GameTask class
+===================================
+ */
+
+// Coroutine hooks
+GameTask GameTask::promise_type::get_return_object()
+{
+    return GameTask(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+std::suspend_always GameTask::promise_type::initial_suspend() noexcept
+{
+    return {};
+}
+
+void GameTask::promise_type::return_void() {}
+
+void GameTask::promise_type::unhandled_exception()
+{
+    exception = std::current_exception();
+}
+
+// Constructors
+GameTask::GameTask() : handle_(nullptr) {}
+
+GameTask::GameTask(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+GameTask::GameTask(GameTask &&task) noexcept : handle_(std::exchange(task.handle_, nullptr)) {}
+
+// Destructor
+GameTask::~GameTask()
+{
+    if (handle_)
+    {
+        handle_.destroy();
+    }
+}
+
+// Operator overloading
+GameTask &GameTask::operator=(GameTask &&task) noexcept
+{
+    if (this != &task)
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+        handle_ = std::exchange(task.handle_, nullptr);
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const GameTask &task)
+{
+    output << "[GameTask] " << (task.isDone() ? "Done" : "Not done");
+    return output;
+}
+
+// Handle to resume a task that no coroutine awaits, e.g. from another thread
+std::coroutine_handle<> GameTask::getHandle() const
+{
+    return handle_;
+}
+
+// Whether the task has run to completion. A task without a coroutine is done.
+bool GameTask::isDone() const
+{
+    return !handle_ || handle_.done();
+}
+
+// Rethrow the exception that ended the task, if any
+void GameTask::rethrowIfFailed() const
+{
+    if (handle_ && handle_.promise().exception)
+    {
+        std::rethrow_exception(handle_.promise().exception);
+    }
+}
+
+// Awaiting a task runs it on the awaiting thread, and resumes the awaiting coroutine once the task is done
+bool GameTask::await_ready() const noexcept
+{
+    return isDone();
+}
+
+std::coroutine_handle<> GameTask::await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept
+{
+    handle_.promise().continuation = awaitingCoroutine;
+    return handle_;
+}
+
+void GameTask::await_resume() const
+{
+    rethrowIfFailed();
+}
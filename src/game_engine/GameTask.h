@@ -0,0 +1,60 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iostream>
+
+
+// Coroutine returning nothing, used for the parts of a game that may have to wait for a player's input (see GameScheduler).
+// A GameTask starts suspended and runs once awaited by another coroutine, which resumes when the task completes.
+// Exceptions thrown by the task are rethrown to the awaiting coroutine. A GameTask owns its coroutine and cannot be copied.
+class GameTask
+{
+public:
+    struct promise_type
+    {
+        std::coroutine_handle<> continuation = nullptr;
+        std::exception_ptr exception = nullptr;
+        GameTask get_return_object();
+        std::suspend_always initial_suspend() noexcept;
+        auto final_suspend() noexcept;
+        void return_void();
+        void unhandled_exception();
+    };
+
+    GameTask();
+    GameTask(GameTask &&task) noexcept;
+    GameTask(const GameTask &task) = delete;
+    ~GameTask();
+    GameTask &operator=(GameTask &&task) noexcept;
+    const GameTask &operator=(const GameTask &task) = delete;
+    friend std::ostream &operator<<(std::ostream &output, const GameTask &task);
+    std::coroutine_handle<> getHandle() const;
+    bool isDone() const;
+    void rethrowIfFailed() const;
+    bool await_ready() const noexcept;
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept;
+    void await_resume() const;
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+    GameTask(std::coroutine_handle<promise_type> handle);
+};
+
+
+// Resume the coroutine awaiting a task once the task is done, without growing the stack of the thread resuming the task
+inline auto GameTask::promise_type::final_suspend() noexcept
+{
+    struct ContinuationAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        void await_resume() const noexcept {}
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> task) const noexcept
+        {
+            std::coroutine_handle<> continuation = task.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+    };
+
+    return ContinuationAwaiter();
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// Compact handles for the players and territories of a game, resolved through the game played on the calling thread
+// (see GameEngine::getPlayer() and GameEngine::getTerritory()). A territory's id is its index in its map, and a player's
+// id its index among the players who joined the game. Handles stay valid across copies of the map, and resolve to
+// nullptr once a player is eliminated.
+using PlayerId = int;
+using TerritoryId = int;
+
+const PlayerId NO_PLAYER_ID = -1;
+const TerritoryId NO_TERRITORY_ID = -1;
@@ -0,0 +1,181 @@
+#include "GameEngine.h"
+#include "ExecutionSchedule.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapGenerator.h"
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+    // Keeps everything logged in a string
+    class StringLogSink : public LogSink
+    {
+    public:
+        StringLogSink(std::string* text) : text_(text) {}
+        void write(const std::string &text) { text_->append(text); }
+        void flush() {}
+
+    private:
+        std::string* text_;
+    };
+
+    struct ExecutionResult
+    {
+        int rounds;
+        long ordersExecuted;
+        long steps;
+        long batches;
+        double executeSeconds;
+        std::string finalState;
+    };
+
+    // Everything about the players that later rounds depend on, including the order of their territories
+    std::string describePlayers(const std::vector<Player*> &players)
+    {
+        std::ostringstream description;
+        for (const auto &player : players)
+        {
+            description << player->getName() << " " << player->getReinforcements() << " " << player->getHand().size() << ":";
+            for (const auto &territory : player->getOwnedTerritories())
+            {
+                description << " " << territory->getId() << "/" << territory->getNumberOfArmies();
+            }
+            description << "\n";
+        }
+
+        return description.str();
+    }
+
+    // Play rounds between 5 AI players until someone is eliminated, timing the execute orders phase. With a
+    // `minimumBatchSize` of 0, the engine decides which batches are worth handing out to the threads.
+    ExecutionResult playRounds(const MapGenerator &generator, int numberOfThreads, int minimumBatchSize, int maximumRounds)
+    {
+        GameEngine gameEngine;
+        GameEngine::setExecutionThreads(numberOfThreads);
+        GameEngine::setMinimumParallelBatchSize(minimumBatchSize);
+        GameEngine::setDeck(new Deck());
+        GameEngine::getDeck()->generateCards(50);
+        GameEngine::setMap(generator.generateMap());
+        GameEngine::setPlayers({
+            new Player("Aggressive", new AggressivePlayerStrategy()),
+            new Player("Benevolent", new BenevolentPlayerStrategy()),
+            new Player("Aggressive 2", new AggressivePlayerStrategy()),
+            new Player("Benevolent 2", new BenevolentPlayerStrategy()),
+            new Player("Aggressive 3", new AggressivePlayerStrategy())
+        });
+        GameEngine::setSeed(42);
+        gameEngine.startupPhase();
+
+        ExecutionResult result = { 0, 0, 0, 0, 0, "" };
+        bool someoneEliminated = false;
+        while (result.rounds < maximumRounds && !someoneEliminated)
+        {
+            gameEngine.reinforcementPhase();
+            gameEngine.issueOrdersPhase();
+
+            // Schedule a copy of the orders to see how many batches they make
+            std::vector<Player*> copies;
+            for (const auto &player : GameEngine::getPlayers())
+            {
+                copies.push_back(new Player(*player));
+            }
+            ExecutionSchedule schedule(copies);
+            for (const auto &batch : schedule.getBatches())
+            {
+                result.steps += batch.size();
+                result.batches++;
+            }
+            for (const auto &copy : copies)
+            {
+                delete copy;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            gameEngine.executeOrdersPhase();
+            result.executeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            result.rounds++;
+            for (const auto &player : GameEngine::getPlayers())
+            {
+                someoneEliminated = someoneEliminated || player->getOwnedTerritories().empty();
+            }
+        }
+        result.ordersExecuted = gameEngine.getNumberOfOrdersExecuted();
+        result.finalState = describePlayers(gameEngine.getCurrentPlayers());
+
+        GameEngine::resetGameEngine();
+        GameEngine::setExecutionThreads(1);
+        GameEngine::setMinimumParallelBatchSize(0);
+        return result;
+    }
+
+    // Play the same rounds `repetitions` times, keeping the fastest execution, as a few milliseconds are easily disturbed
+    ExecutionResult playFastestRounds(const MapGenerator &generator, int numberOfThreads, int minimumBatchSize, int repetitions)
+    {
+        ExecutionResult fastest = playRounds(generator, numberOfThreads, minimumBatchSize, 20);
+        for (int i = 1; i < repetitions; i++)
+        {
+            ExecutionResult result = playRounds(generator, numberOfThreads, minimumBatchSize, 20);
+            if (result.executeSeconds < fastest.executeSeconds)
+            {
+                fastest = result;
+            }
+        }
+
+        return fastest;
+    }
+
+    // Play the rounds once with the game output logged, and return the log
+    std::string logRounds(const MapGenerator &generator, int numberOfThreads, int minimumBatchSize)
+    {
+        std::string log;
+        Logger::setSink(new StringLogSink(&log));
+        Logger::setLevel(INFO_LEVEL);
+        playRounds(generator, numberOfThreads, minimumBatchSize, 20);
+        Logger::setLevel(OFF_LEVEL);
+        Logger::setSink(new NullLogSink());
+
+        return log;
+    }
+}
+
+int main()
+{
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+
+    // Every batch of 2 steps or more is handed out when forced, so that the parallel execution is checked on any machine
+    const int FORCED_BATCH_SIZE = 2;
+    const int REPETITIONS = 7;
+
+    std::cout << std::thread::hardware_concurrency() << " cores" << std::endl;
+    bool allMatch = true;
+    for (const auto &generator : { MapGenerator(8, 8, 4), MapGenerator(16, 16, 4), MapGenerator(32, 32, 8) })
+    {
+        ExecutionResult sequential = playFastestRounds(generator, 1, 0, REPETITIONS);
+        ExecutionResult parallel = playFastestRounds(generator, 4, 0, REPETITIONS);
+        ExecutionResult forced = playFastestRounds(generator, 4, FORCED_BATCH_SIZE, REPETITIONS);
+        bool match = true;
+        for (const auto &result : { parallel, forced })
+        {
+            match = match && sequential.rounds == result.rounds && sequential.ordersExecuted == result.ordersExecuted && sequential.finalState == result.finalState;
+        }
+        // Orders executing on the threads log what they do in the same order as they would one at a time
+        std::string sequentialLog = logRounds(generator, 1, 0);
+        bool logsMatch = sequentialLog == logRounds(generator, 4, FORCED_BATCH_SIZE);
+        allMatch = allMatch && match && logsMatch;
+
+        std::cout << generator.getName() << ": " << sequential.rounds << " rounds, " << sequential.ordersExecuted << " orders executed, ";
+        std::cout << "final states " << (match ? "match" : "DO NOT MATCH") << ", logs " << (logsMatch ? "match" : "DO NOT MATCH");
+        std::cout << " (" << sequentialLog.size() << " bytes)" << std::endl;
+        std::cout << "  " << parallel.steps << " steps in " << parallel.batches << " batches (" << (double) parallel.steps / parallel.batches << " per batch)" << std::endl;
+        std::cout << "  Execute orders phase: " << sequential.executeSeconds * 1000 << " ms on 1 thread, ";
+        std::cout << parallel.executeSeconds * 1000 << " ms on 4 threads (" << sequential.executeSeconds / parallel.executeSeconds << "x), ";
+        std::cout << forced.executeSeconds * 1000 << " ms on 4 threads handing out every batch (";
+        std::cout << sequential.executeSeconds / forced.executeSeconds << "x)" << std::endl;
+    }
+
+    return allMatch ? 0 : 1;
+}
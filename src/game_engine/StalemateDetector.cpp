@@ -0,0 +1,233 @@
+#include "StalemateDetector.h"
+#include <algorithm>
+
+namespace
+{
+    const std::string REASON_NAMES[] = { "In progress", "Conquest", "Repeated state", "No progress", "Round limit" };
+
+    // Owner id of territories that nobody owns (e.g. before the startup phase)
+    const uint32_t NO_OWNER = 0;
+
+    // Territories whose armies are in the same bucket hash the same. Buckets are powers of 2, so that a stack of armies
+    // slowly growing without being used does not count as progress.
+    int getArmyBucket(int armies)
+    {
+        int bucket = 0;
+        while (armies > 0)
+        {
+            bucket++;
+            armies >>= 1;
+        }
+
+        return bucket;
+    }
+
+    // Zobrist key of a (territory, owner, bucket) combination. The keys are derived with the splitmix64 finalizer instead of
+    // being drawn into a table, whose size would grow with the number of players.
+    uint64_t getKey(int territoryId, uint32_t owner, int bucket)
+    {
+        uint64_t key = (static_cast<uint64_t>(territoryId) << 40) ^ (static_cast<uint64_t>(owner) << 8) ^ static_cast<uint64_t>(bucket);
+        key += 0x9e3779b97f4a7c15ULL;
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+        return key ^ (key >> 31);
+    }
+
+    // Key of a territory's owner alone, using a bucket that armies never fall into
+    uint64_t getOwnershipKey(int territoryId, uint32_t owner)
+    {
+        return getKey(territoryId, owner, 0xff);
+    }
+}
+
+
+/*
+===================================
+ Implementation for StalemateDetector class
+===================================
+ */
+
+// Constructors
+StalemateDetector::StalemateDetector()
+    : maximumRepetitions_(10), noProgressRounds_(100), maximumRounds_(1000), hash_(0), ownershipHash_(0), lastOwnershipHash_(0), lastProgressRound_(0) {}
+
+StalemateDetector::StalemateDetector(const StalemateDetector &detector)
+    : maximumRepetitions_(detector.maximumRepetitions_), noProgressRounds_(detector.noProgressRounds_), maximumRounds_(detector.maximumRounds_),
+      hash_(detector.hash_), ownershipHash_(detector.ownershipHash_), lastOwnershipHash_(detector.lastOwnershipHash_),
+      lastProgressRound_(detector.lastProgressRound_), contributions_(detector.contributions_), playerIds_(detector.playerIds_),
+      freePlayerIds_(detector.freePlayerIds_), stateCounts_(detector.stateCounts_) {}
+
+// Operator overloading
+const StalemateDetector &StalemateDetector::operator=(const StalemateDetector &detector)
+{
+    if (this != &detector)
+    {
+        maximumRepetitions_ = detector.maximumRepetitions_;
+        noProgressRounds_ = detector.noProgressRounds_;
+        maximumRounds_ = detector.maximumRounds_;
+        hash_ = detector.hash_;
+        ownershipHash_ = detector.ownershipHash_;
+        lastOwnershipHash_ = detector.lastOwnershipHash_;
+        lastProgressRound_ = detector.lastProgressRound_;
+        contributions_ = detector.contributions_;
+        playerIds_ = detector.playerIds_;
+        freePlayerIds_ = detector.freePlayerIds_;
+        stateCounts_ = detector.stateCounts_;
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const StalemateDetector &detector)
+{
+    output << "[StalemateDetector] State hash " << std::hex << detector.hash_ << std::dec << ", last progress in round " << detector.lastProgressRound_;
+    output << ", " << detector.stateCounts_.size() << " distinct states";
+    return output;
+}
+
+// Getters
+uint64_t StalemateDetector::getHash() const
+{
+    return hash_;
+}
+
+uint64_t StalemateDetector::getOwnershipHash() const
+{
+    return ownershipHash_;
+}
+
+// Setters. A value of 0 disables the corresponding rule.
+// The game is a draw once the same state has been seen at the end of `repetitions` rounds.
+void StalemateDetector::setMaximumRepetitions(int repetitions)
+{
+    maximumRepetitions_ = repetitions;
+}
+
+// The game is a draw once no territory has changed hands for `rounds` rounds.
+void StalemateDetector::setNoProgressRounds(int rounds)
+{
+    noProgressRounds_ = rounds;
+}
+
+// The game is a draw once `rounds` rounds have been played.
+void StalemateDetector::setMaximumRounds(int rounds)
+{
+    maximumRounds_ = rounds;
+}
+
+// Hash the initial state of a game and forget about the previous one
+void StalemateDetector::startGame(const std::vector<Territory*> &territories, const std::vector<Player*> &players)
+{
+    hash_ = 0;
+    ownershipHash_ = 0;
+    lastProgressRound_ = 0;
+    playerIds_.clear();
+    freePlayerIds_.clear();
+    stateCounts_.clear();
+
+    int maximumId = -1;
+    for (const auto &territory : territories)
+    {
+        maximumId = std::max(maximumId, territory->getId());
+    }
+    contributions_.assign(maximumId + 1, { NO_OWNER, 0 });
+    for (const auto &territory : territories)
+    {
+        hash_ ^= getKey(territory->getId(), NO_OWNER, 0);
+        ownershipHash_ ^= getOwnershipKey(territory->getId(), NO_OWNER);
+    }
+
+    for (const auto &player : players)
+    {
+        for (const auto &territory : player->getOwnedTerritories())
+        {
+            updateTerritory(territory, player);
+        }
+    }
+    lastOwnershipHash_ = ownershipHash_;
+}
+
+// Replace the contribution of a territory to the hashes after its owner or armies may have changed
+void StalemateDetector::updateTerritory(Territory* territory, Player* owner)
+{
+    Contribution &contribution = contributions_.at(territory->getId());
+    Contribution updated = { getPlayerId_(owner), getArmyBucket(territory->getNumberOfArmies()) };
+    if (updated.owner == contribution.owner && updated.bucket == contribution.bucket)
+    {
+        return;
+    }
+
+    hash_ ^= getKey(territory->getId(), contribution.owner, contribution.bucket) ^ getKey(territory->getId(), updated.owner, updated.bucket);
+    if (updated.owner != contribution.owner)
+    {
+        ownershipHash_ ^= getOwnershipKey(territory->getId(), contribution.owner) ^ getOwnershipKey(territory->getId(), updated.owner);
+    }
+    contribution = updated;
+}
+
+// Forget a player who has been eliminated and owns no territory anymore. Its address may be reused by a player created later
+// in the game, who must not inherit its id by accident. Its id goes to the next player seen instead (e.g. a new Neutral Player),
+// so that the ids only depend on the players in the game.
+void StalemateDetector::removePlayer(Player* player)
+{
+    auto iterator = playerIds_.find(player);
+    if (iterator != playerIds_.end())
+    {
+        freePlayerIds_.push_back(iterator->second);
+        playerIds_.erase(iterator);
+    }
+}
+
+// Check the state at the end of a round. Returns the reason the game is a draw, or GAME_IN_PROGRESS.
+GameEndReason StalemateDetector::endRound(int round)
+{
+    if (ownershipHash_ != lastOwnershipHash_)
+    {
+        lastOwnershipHash_ = ownershipHash_;
+        lastProgressRound_ = round;
+    }
+
+    if (maximumRepetitions_ > 0 && ++stateCounts_[hash_] >= maximumRepetitions_)
+    {
+        return REPEATED_STATE;
+    }
+    if (noProgressRounds_ > 0 && round - lastProgressRound_ >= noProgressRounds_)
+    {
+        return NO_PROGRESS;
+    }
+    if (maximumRounds_ > 0 && round >= maximumRounds_)
+    {
+        return ROUND_LIMIT;
+    }
+
+    return GAME_IN_PROGRESS;
+}
+
+std::string StalemateDetector::getReasonName(GameEndReason reason)
+{
+    return REASON_NAMES[reason];
+}
+
+// Small id of a player, assigned the first time the player is seen in the game (e.g. the Neutral Player)
+uint32_t StalemateDetector::getPlayerId_(Player* player)
+{
+    if (player == nullptr)
+    {
+        return NO_OWNER;
+    }
+
+    auto iterator = playerIds_.find(player);
+    if (iterator != playerIds_.end())
+    {
+        return iterator->second;
+    }
+
+    uint32_t id = playerIds_.size() + freePlayerIds_.size() + 1;
+    if (!freePlayerIds_.empty())
+    {
+        auto smallestFreeId = min_element(freePlayerIds_.begin(), freePlayerIds_.end());
+        id = *smallestFreeId;
+        freePlayerIds_.erase(smallestFreeId);
+    }
+    playerIds_[player] = id;
+    return id;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../map/Map.h"
+#include "../player/Player.h"
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+class Territory;
+
+// Why a game is over
+enum GameEndReason : short
+{
+    GAME_IN_PROGRESS,
+    CONQUEST,
+    REPEATED_STATE,
+    NO_PROGRESS,
+    ROUND_LIMIT
+};
+
+
+// Ends games that can no longer be won (e.g. between Benevolent players) with a draw.
+// The state of the game is fingerprinted by an incremental Zobrist-style hash over the owner and army bucket of every territory,
+// which is updated as orders execute. At the end of every round, the game is a draw if:
+// - the same state has been seen too many times,
+// - no territory has changed hands for too many rounds, or
+// - the round cap has been reached.
+class StalemateDetector
+{
+public:
+    StalemateDetector();
+    StalemateDetector(const StalemateDetector &detector);
+    const StalemateDetector &operator=(const StalemateDetector &detector);
+    friend std::ostream &operator<<(std::ostream &output, const StalemateDetector &detector);
+    uint64_t getHash() const;
+    uint64_t getOwnershipHash() const;
+    void setMaximumRepetitions(int repetitions);
+    void setNoProgressRounds(int rounds);
+    void setMaximumRounds(int rounds);
+    void startGame(const std::vector<Territory*> &territories, const std::vector<Player*> &players);
+    void updateTerritory(Territory* territory, Player* owner);
+    void removePlayer(Player* player);
+    GameEndReason endRound(int round);
+    static std::string getReasonName(GameEndReason reason);
+
+private:
+    // Owner id and army bucket every territory currently contributes to the hashes, indexed by territory id
+    struct Contribution
+    {
+        uint32_t owner;
+        int bucket;
+    };
+
+    int maximumRepetitions_;
+    int noProgressRounds_;
+    int maximumRounds_;
+    uint64_t hash_;
+    uint64_t ownershipHash_;
+    uint64_t lastOwnershipHash_;
+    int lastProgressRound_;
+    std::vector<Contribution> contributions_;
+    std::unordered_map<Player*, uint32_t> playerIds_;
+    std::vector<uint32_t> freePlayerIds_;
+    std::unordered_map<uint64_t, int> stateCounts_;
+    uint32_t getPlayerId_(Player* player);
+};
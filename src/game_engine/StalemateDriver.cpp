@@ -0,0 +1,72 @@
+#include "GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapLoader.h"
+#include <string>
+
+namespace
+{
+    // Play a game between AI players until it is won or found to be a draw.
+    // While nobody has been eliminated, the incrementally updated hash is checked against a hash computed from scratch every round.
+    void playGame(std::string description, std::vector<Player*> players, int noProgressRounds)
+    {
+        MapLoader loader;
+        GameEngine gameEngine;
+        GameEngine::setDeck(new Deck());
+        GameEngine::getDeck()->generateCards(50);
+        GameEngine::setMap(loader.loadMap("resources/canada.map"));
+        GameEngine::setPlayers(players);
+        GameEngine::setSeed(42);
+        gameEngine.getStalemateDetector().setNoProgressRounds(noProgressRounds);
+
+        gameEngine.startupPhase();
+        int numberOfPlayers = GameEngine::getPlayers().size();
+        int roundsVerified = 0;
+        bool hashMatches = true;
+        bool shouldContinueGame = true;
+        while (shouldContinueGame)
+        {
+            shouldContinueGame = gameEngine.playRound();
+            if (static_cast<int>(GameEngine::getPlayers().size()) == numberOfPlayers)
+            {
+                StalemateDetector fromScratch;
+                fromScratch.startGame(GameEngine::getMap()->getTerritories(), gameEngine.getCurrentPlayers());
+                hashMatches = hashMatches && fromScratch.getHash() == gameEngine.getStalemateDetector().getHash();
+                roundsVerified++;
+            }
+        }
+
+        std::cout << description << ": " << StalemateDetector::getReasonName(gameEngine.getEndReason()) << " after " << gameEngine.getRound() << " rounds" << std::endl;
+        std::cout << "  " << gameEngine.getStalemateDetector() << std::endl;
+        std::cout << "  Incremental hash " << (hashMatches ? "matches" : "DOES NOT MATCH") << " the hash computed from scratch over ";
+        std::cout << roundsVerified << " rounds" << std::endl;
+    }
+}
+
+int main()
+{
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+
+    // Benevolent players never attack each other, so the game can only end in a draw
+    playGame("Benevolent vs Benevolent", {
+        new Player("Benevolent", new BenevolentPlayerStrategy()),
+        new Player("Benevolent 2", new BenevolentPlayerStrategy())
+    }, 20);
+
+    // An Aggressive player eventually conquers the map
+    playGame("Aggressive vs Benevolent", {
+        new Player("Aggressive", new AggressivePlayerStrategy()),
+        new Player("Benevolent", new BenevolentPlayerStrategy())
+    }, 20);
+
+    // Neither Aggressive player gets ahead
+    playGame("Aggressive vs Aggressive", {
+        new Player("Aggressive", new AggressivePlayerStrategy()),
+        new Player("Aggressive 2", new AggressivePlayerStrategy())
+    }, 20);
+
+    // Clean up dynamically allocated memory
+    GameEngine::resetGameEngine();
+
+    return 0;
+}
@@ -0,0 +1,213 @@
+#include "TerritoryDistributor.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <tuple>
+
+namespace
+{
+    const std::string MODE_NAMES[] = { "Random", "Continent-balanced", "Cluster-contiguous", "Army-weighted" };
+
+    // The territories of the map in the order of their ids, so that the same seed always deals the same territories
+    std::vector<Territory*> getTerritoriesById(Map* map)
+    {
+        std::vector<Territory*> territories = map->getTerritories();
+        sort(territories.begin(), territories.end(), [](auto t1, auto t2) { return t1->getId() < t2->getId(); });
+        return territories;
+    }
+
+    std::vector<Territory*> getShuffledTerritories(Map* map, std::mt19937 &random)
+    {
+        std::vector<Territory*> territories = getTerritoriesById(map);
+        shuffle(territories.begin(), territories.end(), random);
+        return territories;
+    }
+}
+
+
+/*
+===================================
+ Implementation for TerritoryDistributor class
+===================================
+ */
+
+// Constructors
+TerritoryDistributor::TerritoryDistributor() : mode_(RANDOM_DISTRIBUTION) {}
+
+TerritoryDistributor::TerritoryDistributor(DistributionMode mode) : mode_(mode) {}
+
+TerritoryDistributor::TerritoryDistributor(const TerritoryDistributor &distributor) : mode_(distributor.mode_) {}
+
+// Operator overloading
+const TerritoryDistributor &TerritoryDistributor::operator=(const TerritoryDistributor &distributor)
+{
+    if (this != &distributor)
+    {
+        mode_ = distributor.mode_;
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const TerritoryDistributor &distributor)
+{
+    output << "[TerritoryDistributor] " << TerritoryDistributor::getModeName(distributor.mode_) << " distribution";
+    return output;
+}
+
+// Getters
+DistributionMode TerritoryDistributor::getMode() const
+{
+    return mode_;
+}
+
+// Setters
+void TerritoryDistributor::setMode(DistributionMode mode)
+{
+    mode_ = mode;
+}
+
+// Deal every territory of `map` to one of `numberOfPlayers` players, in the order the players should receive them
+std::vector<TerritoryAssignment> TerritoryDistributor::distribute(Map* map, int numberOfPlayers, std::mt19937 &random) const
+{
+    if (numberOfPlayers < 1)
+    {
+        throw "Territories can only be distributed to at least one player.";
+    }
+
+    switch (mode_)
+    {
+        case CONTINENT_BALANCED:
+            return distributeByContinent_(map, numberOfPlayers, random);
+        case CLUSTER_CONTIGUOUS:
+            return distributeInClusters_(map, numberOfPlayers, random);
+        case ARMY_WEIGHTED:
+            return distributeByArmies_(map, numberOfPlayers, random);
+        default:
+            return distributeRandomly_(map, numberOfPlayers, random);
+    }
+}
+
+std::string TerritoryDistributor::getModeName(DistributionMode mode)
+{
+    return MODE_NAMES[mode];
+}
+
+// Shuffle the territories once and deal them in turn
+std::vector<TerritoryAssignment> TerritoryDistributor::distributeRandomly_(Map* map, int numberOfPlayers, std::mt19937 &random) const
+{
+    std::vector<TerritoryAssignment> assignments;
+    int player = 0;
+    for (const auto &territory : getShuffledTerritories(map, random))
+    {
+        assignments.push_back({ territory, player });
+        player = (player + 1) % numberOfPlayers;
+    }
+
+    return assignments;
+}
+
+// Shuffle the members of each continent and deal them in turn, carrying on with the next player from one continent to the
+// next so that no player is always the one getting an extra territory
+std::vector<TerritoryAssignment> TerritoryDistributor::distributeByContinent_(Map* map, int numberOfPlayers, std::mt19937 &random) const
+{
+    std::vector<TerritoryAssignment> assignments;
+    std::vector<bool> dealt(map->getNumberOfTerritories(), false);
+    int player = 0;
+    for (const auto &continent : map->getContinents())
+    {
+        std::vector<Territory*> members = continent->getTerritories();
+        sort(members.begin(), members.end(), [](auto t1, auto t2) { return t1->getId() < t2->getId(); });
+        shuffle(members.begin(), members.end(), random);
+        for (const auto &member : members)
+        {
+            if (!dealt.at(member->getId()))
+            {
+                dealt.at(member->getId()) = true;
+                assignments.push_back({ member, player });
+                player = (player + 1) % numberOfPlayers;
+            }
+        }
+    }
+
+    // Territories that belong to no continent are dealt last
+    for (const auto &territory : getTerritoriesById(map))
+    {
+        if (!dealt.at(territory->getId()))
+        {
+            assignments.push_back({ territory, player });
+            player = (player + 1) % numberOfPlayers;
+        }
+    }
+
+    return assignments;
+}
+
+// Grow a region per player by breadth-first search, the players taking turns claiming one territory at a time. Every
+// territory is queued once per neighbor that gets claimed, so the whole distribution takes O(territories + borders).
+std::vector<TerritoryAssignment> TerritoryDistributor::distributeInClusters_(Map* map, int numberOfPlayers, std::mt19937 &random) const
+{
+    std::vector<Territory*> territories = getShuffledTerritories(map, random);
+    std::vector<bool> claimed(territories.size(), false);
+    std::vector<std::queue<Territory*>> frontiers(numberOfPlayers);
+    std::vector<TerritoryAssignment> assignments;
+    int nextRandomTerritory = 0;
+
+    for (int player = 0; assignments.size() < territories.size(); player = (player + 1) % numberOfPlayers)
+    {
+        // Claim the oldest unclaimed territory on the player's border, or else start a new region at random
+        std::queue<Territory*> &frontier = frontiers.at(player);
+        Territory* territory = nullptr;
+        while (territory == nullptr && !frontier.empty())
+        {
+            if (!claimed.at(frontier.front()->getId()))
+            {
+                territory = frontier.front();
+            }
+            frontier.pop();
+        }
+        while (territory == nullptr)
+        {
+            Territory* candidate = territories.at(nextRandomTerritory++);
+            territory = claimed.at(candidate->getId()) ? nullptr : candidate;
+        }
+
+        claimed.at(territory->getId()) = true;
+        assignments.push_back({ territory, player });
+        for (const auto &neighbor : map->getAdjacentTerritories(territory))
+        {
+            if (!claimed.at(neighbor->getId()))
+            {
+                frontier.push(neighbor);
+            }
+        }
+    }
+
+    return assignments;
+}
+
+// Deal the territories from the heaviest to the lightest, where a territory weighs its armies plus one, each one to the
+// player who has the lightest territories so far (then the fewest territories, then the first in turn)
+std::vector<TerritoryAssignment> TerritoryDistributor::distributeByArmies_(Map* map, int numberOfPlayers, std::mt19937 &random) const
+{
+    std::vector<Territory*> territories = getShuffledTerritories(map, random);
+    auto byArmies = [](auto t1, auto t2) { return t1->getNumberOfArmies() > t2->getNumberOfArmies(); };
+    stable_sort(territories.begin(), territories.end(), byArmies);
+
+    using PlayerLoad = std::tuple<long, int, int>;
+    std::priority_queue<PlayerLoad, std::vector<PlayerLoad>, std::greater<PlayerLoad>> players;
+    for (int player = 0; player < numberOfPlayers; player++)
+    {
+        players.push({ 0, 0, player });
+    }
+
+    std::vector<TerritoryAssignment> assignments;
+    for (const auto &territory : territories)
+    {
+        auto [weight, numberOfTerritories, player] = players.top();
+        players.pop();
+        assignments.push_back({ territory, player });
+        players.push({ weight + territory->getNumberOfArmies() + 1, numberOfTerritories + 1, player });
+    }
+
+    return assignments;
+}
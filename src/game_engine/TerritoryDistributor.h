@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../map/Map.h"
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+class Map;
+class Territory;
+
+// How the territories of the map are dealt to the players at startup
+enum DistributionMode : short
+{
+    RANDOM_DISTRIBUTION,
+    CONTINENT_BALANCED,
+    CLUSTER_CONTIGUOUS,
+    ARMY_WEIGHTED
+};
+
+// A territory dealt to a player, given by its index in the players of the game
+struct TerritoryAssignment
+{
+    Territory* territory;
+    int player;
+};
+
+
+// Deals every territory of a map to the players at startup, in one of the distribution modes:
+// - RANDOM_DISTRIBUTION: the territories are shuffled and dealt one at a time to the players in turn.
+// - CONTINENT_BALANCED: the same, one continent after the other, so that every player gets its share of every continent.
+// - CLUSTER_CONTIGUOUS: the players take turns claiming a territory next to the ones they already have, so that they start
+//   in contiguous regions. A player who is walled in starts a new region on a random territory.
+// - ARMY_WEIGHTED: the territories are dealt from the most to the least armies, each one to the player with the fewest
+//   armies and territories so far, so that maps with armies on them at startup are dealt fairly.
+// Every mode gives the players as many territories as each other, give or take one (army-weighted aside), draws all of its
+// randomness from the generator it is given, and runs in O(n log n) or better on maps with territory ids from 0 to n - 1.
+class TerritoryDistributor
+{
+public:
+    TerritoryDistributor();
+    TerritoryDistributor(DistributionMode mode);
+    TerritoryDistributor(const TerritoryDistributor &distributor);
+    const TerritoryDistributor &operator=(const TerritoryDistributor &distributor);
+    friend std::ostream &operator<<(std::ostream &output, const TerritoryDistributor &distributor);
+    DistributionMode getMode() const;
+    void setMode(DistributionMode mode);
+    std::vector<TerritoryAssignment> distribute(Map* map, int numberOfPlayers, std::mt19937 &random) const;
+    static std::string getModeName(DistributionMode mode);
+
+private:
+    DistributionMode mode_;
+    std::vector<TerritoryAssignment> distributeRandomly_(Map* map, int numberOfPlayers, std::mt19937 &random) const;
+    std::vector<TerritoryAssignment> distributeByContinent_(Map* map, int numberOfPlayers, std::mt19937 &random) const;
+    std::vector<TerritoryAssignment> distributeInClusters_(Map* map, int numberOfPlayers, std::mt19937 &random) const;
+    std::vector<TerritoryAssignment> distributeByArmies_(Map* map, int numberOfPlayers, std::mt19937 &random) const;
+};
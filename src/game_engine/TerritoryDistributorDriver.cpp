@@ -0,0 +1,164 @@
+#include "GameEngine.h"
+#include "TerritoryDistributor.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <queue>
+#include <string>
+
+namespace
+{
+    const std::vector<DistributionMode> MODES = { RANDOM_DISTRIBUTION, CONTINENT_BALANCED, CLUSTER_CONTIGUOUS, ARMY_WEIGHTED };
+
+    // Number of connected regions a player's territories form
+    int countRegions(Map* map, const std::vector<int> &owners, int player, const std::vector<Territory*> &territories)
+    {
+        std::vector<bool> visited(owners.size(), false);
+        int regions = 0;
+        for (const auto &start : territories)
+        {
+            if (visited.at(start->getId()))
+            {
+                continue;
+            }
+
+            regions++;
+            std::queue<Territory*> toVisit;
+            toVisit.push(start);
+            visited.at(start->getId()) = true;
+            while (!toVisit.empty())
+            {
+                for (const auto &neighbor : map->getAdjacentTerritories(toVisit.front()))
+                {
+                    if (owners.at(neighbor->getId()) == player && !visited.at(neighbor->getId()))
+                    {
+                        visited.at(neighbor->getId()) = true;
+                        toVisit.push(neighbor);
+                    }
+                }
+                toVisit.pop();
+            }
+        }
+
+        return regions;
+    }
+
+    // Deal a map in every mode and report how long it took, how even the players' shares are and how scattered they are.
+    // Returns `false` if a mode left a territory out or dealt it twice.
+    bool distribute(Map* map, int numberOfPlayers, bool countingRegions)
+    {
+        bool valid = true;
+        for (const auto &mode : MODES)
+        {
+            TerritoryDistributor distributor(mode);
+            std::mt19937 random(42);
+            auto start = std::chrono::steady_clock::now();
+            std::vector<TerritoryAssignment> assignments = distributor.distribute(map, numberOfPlayers, random);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::vector<int> owners(map->getNumberOfTerritories(), -1);
+            std::vector<std::vector<Territory*>> territories(numberOfPlayers);
+            std::vector<long> armies(numberOfPlayers, 0);
+            for (const auto &assignment : assignments)
+            {
+                valid = valid && owners.at(assignment.territory->getId()) == -1;
+                owners.at(assignment.territory->getId()) = assignment.player;
+                territories.at(assignment.player).push_back(assignment.territory);
+                armies.at(assignment.player) += assignment.territory->getNumberOfArmies();
+            }
+            valid = valid && find(owners.begin(), owners.end(), -1) == owners.end();
+
+            auto bySize = [](const auto &t1, const auto &t2) { return t1.size() < t2.size(); };
+            auto sizes = minmax_element(territories.begin(), territories.end(), bySize);
+            auto armySpread = minmax_element(armies.begin(), armies.end());
+            std::cout << "  " << std::left << std::setw(20) << TerritoryDistributor::getModeName(mode) << std::right;
+            std::cout << std::setw(10) << 1000 * seconds << " ms, " << sizes.first->size() << "-" << sizes.second->size() << " territories, ";
+            std::cout << *armySpread.first << "-" << *armySpread.second << " armies per player";
+
+            if (countingRegions)
+            {
+                long regions = 0;
+                for (int player = 0; player < numberOfPlayers; player++)
+                {
+                    regions += countRegions(map, owners, player, territories.at(player));
+                }
+                std::cout << ", " << (double)regions / numberOfPlayers << " regions per player";
+            }
+            std::cout << std::endl;
+        }
+
+        return valid;
+    }
+}
+
+int main()
+{
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+    std::cout << std::fixed << std::setprecision(1);
+
+    // Give some territories armies at startup, like a scenario map would, so that the army-weighted deal has work to do
+    bool valid = true;
+    for (const auto &size : std::vector<std::vector<int>>{ { 20, 20, 4, 6 }, { 316, 316, 10, 100 }, { 1000, 1000, 10, 1000 } })
+    {
+        MapGenerator generator(size.at(0), size.at(1), size.at(2));
+        Map* map = generator.generateMap();
+        std::vector<Territory*> territories = map->getTerritories();
+        for (const auto &territory : territories)
+        {
+            territory->addArmies(territory->getId() % 7 == 0 ? territory->getId() % 50 : 0);
+        }
+
+        std::cout << generator << ", " << size.at(3) << " players:" << std::endl;
+        valid = distribute(map, size.at(3), territories.size() <= 100000) && valid;
+        delete map;
+    }
+
+    // A game deals its territories from the same generator that shuffles its players
+    MapGenerator generator(8, 8, 4);
+    GameEngine gameEngine;
+    GameEngine::setDeck(new Deck());
+    GameEngine::setMap(generator.generateMap());
+    GameEngine::setPlayers({ new Player("Aggressive", new AggressivePlayerStrategy()), new Player("Benevolent", new BenevolentPlayerStrategy()) });
+    GameEngine::setSeed(7);
+    gameEngine.getDistributor().setMode(CLUSTER_CONTIGUOUS);
+    gameEngine.startupPhase();
+    std::cout << gameEngine.getDistributor() << " of " << generator << ":" << std::endl;
+    for (const auto &player : GameEngine::getPlayers())
+    {
+        std::cout << "  " << *player << std::endl;
+    }
+    GameEngine::resetGameEngine();
+
+    // Players who are dealt nothing when there are more players than territories are out before the first round
+    MapGenerator smallGenerator(4, 4, 4);
+    std::vector<Player*> players;
+    for (int i = 0; i < 40; i++)
+    {
+        players.push_back(new Player("Player " + std::to_string(i + 1), i % 2 == 0 ? (PlayerStrategy*)new AggressivePlayerStrategy() : new BenevolentPlayerStrategy()));
+    }
+    GameEngine::setDeck(new Deck());
+    GameEngine::getDeck()->generateCards(50);
+    GameEngine::setMap(smallGenerator.generateMap());
+    GameEngine::setPlayers(players);
+    GameEngine::setSeed(7);
+    gameEngine.getDistributor().setMode(RANDOM_DISTRIBUTION);
+    gameEngine.startupPhase();
+    bool everyPlayerDealt = true;
+    for (const auto &player : GameEngine::getPlayers())
+    {
+        everyPlayerDealt = everyPlayerDealt && player->getNumberOfOwnedTerritories() > 0;
+    }
+    int playersLeft = GameEngine::getPlayers().size();
+    while (gameEngine.getRound() < 10 && gameEngine.playRound()) {}
+    std::cout << "40 players on " << smallGenerator << ": " << playersLeft << " left after startup, ";
+    std::cout << gameEngine.getRound() << " rounds played" << std::endl;
+    GameEngine::resetGameEngine();
+
+    bool playersRemoved = everyPlayerDealt && playersLeft == 16;
+    std::cout << (valid ? "Every territory was dealt exactly once." : "A territory was NOT dealt exactly once.") << std::endl;
+    std::cout << (playersRemoved ? "Every player left after startup owns a territory." : "A player was left without a territory.") << std::endl;
+    return valid && playersRemoved ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+#include "WorkerPool.h"
+#include <algorithm>
+#include <chrono>
+
+namespace
+{
+    // Number of empty batches timed to measure what handing out a batch costs
+    const int DISPATCH_SAMPLES = 15;
+}
+
+
+/*
+===================================
+ Implementation for WorkerPool class
+===================================
+ */
+
+// Constructor. The thread submitting batches counts as one of the `numberOfThreads`.
+WorkerPool::WorkerPool(int numberOfThreads)
+    : task_(nullptr), numberOfTasks_(0), nextTask_(0), tasksDone_(0), busyThreads_(0), batch_(0), stopping_(false),
+      dispatchSeconds_(0)
+{
+    for (int i = 1; i < numberOfThreads; i++)
+    {
+        threads_.emplace_back(&WorkerPool::work_, this);
+    }
+
+    // The median time to run a batch of empty tasks, one per thread
+    std::vector<double> samples;
+    for (int i = 0; i < DISPATCH_SAMPLES; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run(numberOfThreads, [](int) {});
+        samples.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::nth_element(samples.begin(), samples.begin() + DISPATCH_SAMPLES / 2, samples.end());
+    dispatchSeconds_ = samples.at(DISPATCH_SAMPLES / 2);
+}
+
+// Destructor
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workReady_.notify_all();
+
+    for (auto &thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const WorkerPool &pool)
+{
+    output << "[WorkerPool] " << pool.getNumberOfThreads() << " threads";
+    return output;
+}
+
+// Getters
+int WorkerPool::getNumberOfThreads() const
+{
+    return threads_.size() + 1;
+}
+
+// Time it takes to hand out a batch and wait for it, on top of running its tasks
+double WorkerPool::getDispatchSeconds() const
+{
+    return dispatchSeconds_;
+}
+
+// Call `task` with every index from 0 to `numberOfTasks` - 1, spread over the threads. Returns once all calls are done.
+// Batches submitted by several threads at once (e.g. by games played side by side) run one after the other.
+void WorkerPool::run(int numberOfTasks, const std::function<void(int)> &task)
+{
+    std::lock_guard<std::mutex> runLock(runMutex_);
+    {
+        // Threads still leaving the previous batch must not pick up tasks of this one
+        std::unique_lock<std::mutex> lock(mutex_);
+        workDone_.wait(lock, [this]() { return busyThreads_ == 0; });
+        task_ = &task;
+        numberOfTasks_ = numberOfTasks;
+        nextTask_ = 0;
+        tasksDone_ = 0;
+        batch_++;
+    }
+    workReady_.notify_all();
+
+    runTasks_(&task, numberOfTasks);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    workDone_.wait(lock, [this]() { return tasksDone_ == numberOfTasks_; });
+}
+
+// Loop of the worker threads: wait for a batch, help run its tasks and wait for the next one
+void WorkerPool::work_()
+{
+    unsigned long lastBatch = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        workReady_.wait(lock, [this, lastBatch]() { return stopping_ || batch_ != lastBatch; });
+        if (stopping_)
+        {
+            return;
+        }
+
+        lastBatch = batch_;
+        const std::function<void(int)>* task = task_;
+        int numberOfTasks = numberOfTasks_;
+        busyThreads_++;
+        lock.unlock();
+
+        runTasks_(task, numberOfTasks);
+
+        lock.lock();
+        busyThreads_--;
+        workDone_.notify_all();
+    }
+}
+
+// Take tasks of the current batch until there are none left
+void WorkerPool::runTasks_(const std::function<void(int)>* task, int numberOfTasks)
+{
+    int index = nextTask_++;
+    while (index < numberOfTasks)
+    {
+        (*task)(index);
+        if (++tasksDone_ == numberOfTasks)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            workDone_.notify_all();
+        }
+        index = nextTask_++;
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// A fixed set of threads that run the tasks of a batch together with the thread that submits it.
+// The threads are started once and wait between batches, so that a phase can run many small batches. What it costs to
+// hand out a batch is measured when the pool starts, so that callers can tell which batches are worth handing out.
+class WorkerPool
+{
+public:
+    WorkerPool(int numberOfThreads);
+    WorkerPool(const WorkerPool &pool) = delete;
+    ~WorkerPool();
+    const WorkerPool &operator=(const WorkerPool &pool) = delete;
+    friend std::ostream &operator<<(std::ostream &output, const WorkerPool &pool);
+    int getNumberOfThreads() const;
+    double getDispatchSeconds() const;
+    void run(int numberOfTasks, const std::function<void(int)> &task);
+
+private:
+    std::vector<std::thread> threads_;
+    std::mutex runMutex_;
+    std::mutex mutex_;
+    std::condition_variable workReady_;
+    std::condition_variable workDone_;
+    const std::function<void(int)>* task_;
+    int numberOfTasks_;
+    std::atomic<int> nextTask_;
+    std::atomic<int> tasksDone_;
+    int busyThreads_;
+    unsigned long batch_;
+    bool stopping_;
+    double dispatchSeconds_;
+    void work_();
+    void runTasks_(const std::function<void(int)>* task, int numberOfTasks);
+};
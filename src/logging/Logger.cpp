@@ -0,0 +1,190 @@
+#include "Logger.h"
+
+namespace
+{
+    // Per-thread buffer that messages are formatted into until they are handed to the sink, or kept aside in
+    // `deferredOutput` (see Logger::deferOutput()). Whatever is left in the buffer is flushed when its thread exits.
+    struct ThreadBuffer
+    {
+        std::ostringstream stream;
+        std::string* deferredOutput = nullptr;
+
+        ~ThreadBuffer()
+        {
+            Logger::flush();
+        }
+    };
+
+    ThreadBuffer &getThreadBuffer()
+    {
+        thread_local ThreadBuffer buffer;
+        return buffer;
+    }
+}
+
+
+/* 
+===================================
+ Implementation for LogSink classes
+===================================
+ */
+
+// Destructor
+LogSink::~LogSink() {}
+
+// Write text to the console. The console stream is left to flush on its own (or when input is read).
+void ConsoleLogSink::write(const std::string &text)
+{
+    std::cout.write(text.data(), text.size());
+}
+
+void ConsoleLogSink::flush()
+{
+    std::cout.flush();
+}
+
+// Constructor
+FileLogSink::FileLogSink(std::string filename) : output_(filename, std::ios::app)
+{
+    if (!output_.is_open())
+    {
+        throw "Unable to open log file";
+    }
+}
+
+// Destructor
+FileLogSink::~FileLogSink()
+{
+    output_.close();
+}
+
+// Append text to the log file
+void FileLogSink::write(const std::string &text)
+{
+    output_.write(text.data(), text.size());
+}
+
+void FileLogSink::flush()
+{
+    output_.flush();
+}
+
+// Discard everything
+void NullLogSink::write(const std::string &) {}
+
+void NullLogSink::flush() {}
+
+
+/* 
+===================================
+ Implementation for Logger class
+===================================
+ */
+
+// Initialize static members
+std::atomic<short> Logger::level_(INFO_LEVEL);
+std::atomic<size_t> Logger::bufferSize_(0);
+LogSink* Logger::sink_ = new ConsoleLogSink();
+std::mutex Logger::sinkMutex_;
+
+// Check whether messages of the specified level are currently logged
+bool Logger::isEnabled(LogLevel level)
+{
+    return level >= level_.load(std::memory_order_relaxed);
+}
+
+// Getter and setters
+LogLevel Logger::getLevel()
+{
+    return static_cast<LogLevel>(level_.load());
+}
+
+void Logger::setLevel(LogLevel level)
+{
+    level_ = level;
+}
+
+// Replace the output of the logger. Buffered messages are written to the previous sink first.
+void Logger::setSink(LogSink* sink)
+{
+    flush();
+
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    delete sink_;
+    sink_ = sink;
+}
+
+// Set how many bytes of messages each thread accumulates before handing them to the sink.
+// The default of 0 writes every message through immediately, which keeps log lines in order with console prompts.
+void Logger::setBufferSize(size_t bytes)
+{
+    flush();
+    bufferSize_ = bytes;
+}
+
+// Keep the messages logged on the calling thread in `output` instead of handing them to the sink. Pass nullptr to log
+// through the sink again. This lets work spread over several threads log in a set order, with write(), once it is done.
+void Logger::deferOutput(std::string* output)
+{
+    ThreadBuffer &buffer = getThreadBuffer();
+    if (buffer.deferredOutput == nullptr && buffer.stream.tellp() > 0)
+    {
+        drain_(buffer.stream);
+    }
+    buffer.deferredOutput = output;
+}
+
+// Log text that was already formatted, such as messages kept aside with deferOutput(), whatever the current level
+void Logger::write(const std::string &text)
+{
+    if (!text.empty())
+    {
+        begin() << text;
+        end();
+    }
+}
+
+// Get the current thread's buffer to format a message into
+std::ostream &Logger::begin()
+{
+    return getThreadBuffer().stream;
+}
+
+// Finish a message, handing the buffer over to the sink once it is full
+void Logger::end()
+{
+    ThreadBuffer &buffer = getThreadBuffer();
+    std::ostringstream &stream = buffer.stream;
+    if (buffer.deferredOutput != nullptr)
+    {
+        buffer.deferredOutput->append(stream.str());
+        stream.str("");
+    }
+    else if (static_cast<size_t>(stream.tellp()) >= bufferSize_.load(std::memory_order_relaxed))
+    {
+        drain_(stream);
+    }
+}
+
+// Write the current thread's buffered messages to the sink and flush it
+void Logger::flush()
+{
+    drain_(getThreadBuffer().stream);
+
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    sink_->flush();
+}
+
+// Helper method to hand the contents of a thread buffer over to the sink
+void Logger::drain_(std::ostringstream &stream)
+{
+    std::string text = stream.str();
+    if (text.empty())
+    {
+        return;
+    }
+    stream.str("");
+
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    sink_->write(text);
+}
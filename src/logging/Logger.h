@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+enum LogLevel : short
+{
+    DEBUG_LEVEL,
+    INFO_LEVEL,
+    WARNING_LEVEL,
+    ERROR_LEVEL,
+    OFF_LEVEL
+};
+
+// Messages below this level are compiled out entirely. Set through the `WARZONE_LOG_LEVEL` CMake cache variable.
+#ifndef WARZONE_LOG_LEVEL
+#define WARZONE_LOG_LEVEL 0
+#endif
+
+// Log a message built with `<<` (e.g. `LOG_INFO("Deployed " << armies << " armies.\n")`).
+// The message is only formatted if its level is enabled both at compile time and at runtime.
+// Messages are written as-is: include the line breaks where they are wanted.
+#define WARZONE_LOG(level, message)                                     \
+    do                                                                  \
+    {                                                                   \
+        if ((level) >= WARZONE_LOG_LEVEL && Logger::isEnabled(level))   \
+        {                                                               \
+            Logger::begin() << message;                                 \
+            Logger::end();                                              \
+        }                                                               \
+    } while (false)
+
+#define LOG_DEBUG(message) WARZONE_LOG(DEBUG_LEVEL, message)
+#define LOG_INFO(message) WARZONE_LOG(INFO_LEVEL, message)
+#define LOG_WARNING(message) WARZONE_LOG(WARNING_LEVEL, message)
+#define LOG_ERROR(message) WARZONE_LOG(ERROR_LEVEL, message)
+
+
+class LogSink
+{
+public:
+    virtual ~LogSink();
+    virtual void write(const std::string &text) = 0;
+    virtual void flush() = 0;
+};
+
+
+class ConsoleLogSink : public LogSink
+{
+public:
+    void write(const std::string &text);
+    void flush();
+};
+
+
+class FileLogSink : public LogSink
+{
+public:
+    FileLogSink(std::string filename);
+    ~FileLogSink();
+    void write(const std::string &text);
+    void flush();
+
+private:
+    std::ofstream output_;
+};
+
+
+class NullLogSink : public LogSink
+{
+public:
+    void write(const std::string &text);
+    void flush();
+};
+
+
+class Logger
+{
+public:
+    static bool isEnabled(LogLevel level);
+    static LogLevel getLevel();
+    static void setLevel(LogLevel level);
+    static void setSink(LogSink* sink);
+    static void setBufferSize(size_t bytes);
+    static void deferOutput(std::string* output);
+    static void write(const std::string &text);
+    static std::ostream &begin();
+    static void end();
+    static void flush();
+
+private:
+    static std::atomic<short> level_;
+    static std::atomic<size_t> bufferSize_;
+    static LogSink* sink_;
+    static std::mutex sinkMutex_;
+    static void drain_(std::ostringstream &stream);
+};
@@ -0,0 +1,66 @@
+#include "Logger.h"
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+    // Log a number of order-like messages and return how long it took in microseconds.
+    long long logMessages(int numberOfMessages)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < numberOfMessages; i++)
+        {
+            LOG_INFO("[Player " << i % 5 << "] Deployed " << i % 20 << " armies to Territory_" << i << ".\n");
+        }
+        Logger::flush();
+        auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+}
+
+int main()
+{
+    // Levels
+    std::cout << "===== Log levels =====" << std::endl;
+    LOG_DEBUG("This debug message is hidden at the default INFO level.\n");
+    LOG_INFO("This info message is shown.\n");
+    Logger::setLevel(WARNING_LEVEL);
+    LOG_INFO("This info message is hidden at the WARNING level.\n");
+    LOG_WARNING("This warning is shown.\n");
+
+    // Messages are never formatted when their level is disabled
+    int formatted = 0;
+    auto expensive = [&formatted]() { formatted++; return "expensive"; };
+    LOG_DEBUG("Building an " << expensive() << " message.\n");
+    std::cout << "Disabled messages formatted: " << formatted << std::endl;
+    Logger::setLevel(INFO_LEVEL);
+
+    // Compare the cost of the different sinks and buffering modes
+    const int NUMBER_OF_MESSAGES = 200000;
+
+    Logger::setSink(new FileLogSink("warzone.log"));
+    long long unbuffered = logMessages(NUMBER_OF_MESSAGES);
+
+    Logger::setBufferSize(64 * 1024);
+    long long buffered = logMessages(NUMBER_OF_MESSAGES);
+
+    Logger::setSink(new NullLogSink());
+    long long silenced = logMessages(NUMBER_OF_MESSAGES);
+
+    Logger::setLevel(OFF_LEVEL);
+    long long disabled = logMessages(NUMBER_OF_MESSAGES);
+
+    Logger::setLevel(INFO_LEVEL);
+    Logger::setSink(new ConsoleLogSink());
+    Logger::setBufferSize(0);
+    remove("warzone.log");
+
+    std::cout << "\n===== Time to log " << NUMBER_OF_MESSAGES << " messages =====" << std::endl;
+    std::cout << "File sink, unbuffered: " << unbuffered << " us" << std::endl;
+    std::cout << "File sink, buffered:   " << buffered << " us" << std::endl;
+    std::cout << "Null sink:             " << silenced << " us" << std::endl;
+    std::cout << "Logging disabled:      " << disabled << " us" << std::endl;
+
+    return 0;
+}
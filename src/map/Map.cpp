@@ -1,7 +1,9 @@
 #include "Map.h"
+#include "../player/Player.h"
 #include <algorithm>
 #include <queue>
 #include <unordered_set>
+#include <utility>
 
 /* 
 ===================================
@@ -9,13 +11,14 @@
 ===================================
  */
 
-// Constructors
-Territory::Territory(): name_("unknown_territory"), numberOfArmies_(0), pendingIncomingArmies_(0), pendingOutgoingArmies_(0) {}
+// Constructors. A copied territory is not owned by anyone: it is owned through the player's list of territories, which
+// does not know about the copy.
+Territory::Territory(): name_("unknown_territory"), id_(NO_TERRITORY_ID), numberOfArmies_(0), pendingIncomingArmies_(0), pendingOutgoingArmies_(0), owner_(nullptr) {}
 
-Territory::Territory(std::string name) : name_(name), numberOfArmies_(0), pendingIncomingArmies_(0), pendingOutgoingArmies_(0) {}
+Territory::Territory(std::string name) : name_(std::move(name)), id_(NO_TERRITORY_ID), numberOfArmies_(0), pendingIncomingArmies_(0), pendingOutgoingArmies_(0), owner_(nullptr) {}
 
 Territory::Territory(const Territory &territory)
-    : name_(territory.name_), numberOfArmies_(territory.numberOfArmies_), pendingIncomingArmies_(territory.pendingIncomingArmies_), pendingOutgoingArmies_(territory.pendingOutgoingArmies_) {}
+    : name_(territory.name_), id_(territory.id_), numberOfArmies_(territory.numberOfArmies_), pendingIncomingArmies_(territory.pendingIncomingArmies_), pendingOutgoingArmies_(territory.pendingOutgoingArmies_), owner_(nullptr) {}
 
 // Operator overloading
 const Territory &Territory::operator=(const Territory &territory)
@@ -23,9 +26,15 @@ const Territory &Territory::operator=(const Territory &territory)
     if (this != &territory)
     {
         name_ = territory.name_;
+        id_ = territory.id_;
         numberOfArmies_ = territory.numberOfArmies_;
         pendingIncomingArmies_ = territory.pendingIncomingArmies_;
         pendingOutgoingArmies_ = territory.pendingOutgoingArmies_;
+
+        if (owner_ != nullptr)
+        {
+            owner_->updateTerritoryStrength(this);
+        }
     }
     return *this;
 }
@@ -36,12 +45,14 @@ std::ostream &operator<<(std::ostream &output, const Territory &territory)
     return output;
 }
 
+// Territories are the same if they have the same id in their map, or the same name when they are not part of one
 bool operator==(const Territory &t1, const Territory &t2)
 {
-    return t1.name_ == t2.name_
-        && t1.numberOfArmies_ == t2.numberOfArmies_
-        && t1.pendingIncomingArmies_ == t2.pendingIncomingArmies_
-        && t1.pendingOutgoingArmies_ == t2.pendingOutgoingArmies_;
+    if (t1.id_ != NO_TERRITORY_ID && t2.id_ != NO_TERRITORY_ID)
+    {
+        return t1.id_ == t2.id_;
+    }
+    return t1.name_ == t2.name_;
 }
 
 // Getters
@@ -50,6 +61,11 @@ std::string Territory::getName() const
     return name_;
 }
 
+TerritoryId Territory::getId() const
+{
+    return id_;
+}
+
 int Territory::getNumberOfArmies() const
 {
     return numberOfArmies_;
@@ -65,10 +81,22 @@ int Territory::getPendingOutgoingArmies() const
     return pendingOutgoingArmies_;
 }
 
+// Player owning the territory, or nullptr if it is unowned. Kept up to date by Player::addOwnedTerritory() and
+// Player::removeOwnedTerritory().
+Player* Territory::getOwner() const
+{
+    return owner_;
+}
+
 // Setters
 void Territory::setName(std::string name)
 {
-    name_ = name;
+    name_ = std::move(name);
+}
+
+void Territory::setId(TerritoryId id)
+{
+    id_ = id;
 }
 
 void Territory::setPendingIncomingArmies(int armies)
@@ -81,6 +109,11 @@ void Territory::setPendingOutgoingArmies(int armies)
     pendingOutgoingArmies_ = armies;
 }
 
+void Territory::setOwner(Player* owner)
+{
+    owner_ = owner;
+}
+
 // Remove a number of armies to the current territory
 void Territory::removeArmies(int armies)
 {
@@ -89,12 +122,22 @@ void Territory::removeArmies(int armies)
     {
         numberOfArmies_ = 0;
     }
+
+    if (owner_ != nullptr)
+    {
+        owner_->updateTerritoryStrength(this);
+    }
 }
 
 // Add a number of armies to the current territory
 void Territory::addArmies(int armies)
 {
     numberOfArmies_ += armies;
+
+    if (owner_ != nullptr)
+    {
+        owner_->updateTerritoryStrength(this);
+    }
 }
 
 // Add a number of armies pending deployment to the current territory
@@ -125,7 +168,7 @@ int Territory::getNumberOfMovableArmies()
 // Constructors
 Continent::Continent(): name_("unknown_continent"), controlValue_(0) {}
 
-Continent::Continent(std::string name, int controlValue) : name_(name), controlValue_(controlValue) {}
+Continent::Continent(std::string name, int controlValue) : name_(std::move(name)), controlValue_(controlValue) {}
 
 Continent::Continent(const Continent &continent) : name_(continent.name_), controlValue_(continent.controlValue_)
 {
@@ -182,7 +225,7 @@ std::vector<Territory*> Continent::getTerritories() const
 // Setters
 void Continent::setName(std::string name)
 {
-    name_ = name;
+    name_ = std::move(name);
 }
 
 void Continent::setControlValue(int value)
@@ -192,7 +235,7 @@ void Continent::setControlValue(int value)
 
 void Continent::setTerritories(std::vector<Territory*> territories)
 {
-    territories_ = territories;
+    territories_ = std::move(territories);
 }
 
 // Add a territory to the current continent.
@@ -208,16 +251,30 @@ void Continent::addTerritory(Territory* territory)
 ===================================
  */
 
-// Constructors
+// Constructors. The map owns the continents it is given, and through them the territories. Pass the containers with
+// std::move() to hand them over without copying them.
 Map::Map() {}
 
-Map::Map(std::vector<Continent*> continents, std::unordered_map<Territory*, std::vector<Territory*>> adjacencyList) : continents_(continents), adjacencyList_(adjacencyList) {}
+Map::Map(std::vector<Continent*> continents, std::unordered_map<Territory*, std::vector<Territory*>> adjacencyList)
+    : continents_(std::move(continents)), adjacencyList_(std::move(adjacencyList))
+{
+    assignTerritoryIds_();
+}
 
 Map::Map(const Map &map)
 {
     copyMapContents_(map);
 }
 
+// A moved map takes over the continents and territories of `map`, which is left empty. Territories keep their owners.
+Map::Map(Map &&map) noexcept
+    : continents_(std::move(map.continents_)), adjacencyList_(std::move(map.adjacencyList_)), territoriesById_(std::move(map.territoriesById_))
+{
+    map.continents_.clear();
+    map.adjacencyList_.clear();
+    map.territoriesById_.clear();
+}
+
 // Destructor
 Map::~Map()
 {
@@ -235,6 +292,21 @@ const Map &Map::operator=(const Map &map)
     return *this;
 }
 
+const Map &Map::operator=(Map &&map) noexcept
+{
+    if (this != &map)
+    {
+        destroyMapContents_();
+        continents_ = std::move(map.continents_);
+        adjacencyList_ = std::move(map.adjacencyList_);
+        territoriesById_ = std::move(map.territoriesById_);
+        map.continents_.clear();
+        map.adjacencyList_.clear();
+        map.territoriesById_.clear();
+    }
+    return *this;
+}
+
 std::ostream &operator<<(std::ostream &output, const Map &map)
 {
     output << "[Map]: " << map.adjacencyList_.size() << " Territories, " << map.continents_.size() << " Continents";
@@ -264,6 +336,17 @@ std::vector<Territory*> Map::getTerritories() const
     return territories;
 }
 
+int Map::getNumberOfTerritories() const
+{
+    return adjacencyList_.size();
+}
+
+// Find a territory of the map by id. Return nullptr if there is none.
+Territory* Map::getTerritory(TerritoryId id) const
+{
+    return id >= 0 && id < static_cast<int>(territoriesById_.size()) ? territoriesById_[id] : nullptr;
+}
+
 // Return a list of territories that are adjacent to the one specified
 std::vector<Territory*> Map::getAdjacentTerritories(Territory* territory)
 {
@@ -378,6 +461,38 @@ bool Map::checkTerritoriesValidity_()
     return true;
 }
 
+// Helper method to give every territory a stable id (its position in continent/file order).
+// Territories that do not belong to any continent are numbered after the continent members.
+void Map::assignTerritoryIds_()
+{
+    int nextId = 0;
+    std::unordered_set<Territory*> numberedTerritories;
+    for (const auto &continent : continents_)
+    {
+        for (const auto &territory : continent->getTerritories())
+        {
+            if (numberedTerritories.insert(territory).second)
+            {
+                territory->setId(nextId++);
+            }
+        }
+    }
+
+    for (const auto &entry : adjacencyList_)
+    {
+        if (numberedTerritories.insert(entry.first).second)
+        {
+            entry.first->setId(nextId++);
+        }
+    }
+
+    territoriesById_.assign(nextId, nullptr);
+    for (const auto &territory : numberedTerritories)
+    {
+        territoriesById_.at(territory->getId()) = territory;
+    }
+}
+
 // Helper method to copy the contents of another Map object. 
 void Map::copyMapContents_(const Map &map)
 {
@@ -387,27 +502,37 @@ void Map::copyMapContents_(const Map &map)
         continents_.push_back(new Continent(*continent));
     }
 
-    // Get all the territories from the continents
-    for (const auto &continent : continents_)
+    // Get all the territories from the continents, along with the territory each one is a copy of. Continents copy their
+    // territories in order.
+    std::unordered_map<Territory*, Territory*> copies;
+    for (size_t i = 0; i < continents_.size(); i++)
     {
-        for (const auto &territory : continent->getTerritories())
+        std::vector<Territory*> originalTerritories = map.continents_.at(i)->getTerritories();
+        std::vector<Territory*> copiedTerritories = continents_.at(i)->getTerritories();
+        for (size_t j = 0; j < copiedTerritories.size(); j++)
         {
-            adjacencyList_[territory];
+            adjacencyList_[copiedTerritories.at(j)];
+            copies[originalTerritories.at(j)] = copiedTerritories.at(j);
         }
     }
 
     // Rebuild the adjacency list using `map.adjacencyList_` as reference
     for (const auto &entry : map.adjacencyList_)
     {
-        auto matchingEntry = [&entry](const auto &kvp) { return *kvp.first == *entry.first; };
-        auto iterator = find_if(adjacencyList_.begin(), adjacencyList_.end(), matchingEntry);
-        Territory* territoryKey = iterator->first;
-
+        std::vector<Territory*> &neighbors = adjacencyList_[copies.at(entry.first)];
         for (const auto &territoryToCopy : entry.second)
         {
-            auto matchingTerritory = [&territoryToCopy](const auto &kvp) { return *kvp.first == *territoryToCopy; };
-            auto matchingTerritoryIterator = find_if(adjacencyList_.begin(), adjacencyList_.end(), matchingTerritory);
-            adjacencyList_[territoryKey].push_back(matchingTerritoryIterator->first);
+            neighbors.push_back(copies.at(territoryToCopy));
+        }
+    }
+
+    // Copies keep the ids of the territories they are copies of
+    territoriesById_.assign(map.territoriesById_.size(), nullptr);
+    for (const auto &copy : copies)
+    {
+        if (copy.first->getId() >= 0 && copy.first->getId() < static_cast<int>(territoriesById_.size()))
+        {
+            territoriesById_.at(copy.first->getId()) = copy.second;
         }
     }
 }
@@ -421,4 +546,5 @@ void Map::destroyMapContents_()
     }
     continents_.clear();
     adjacencyList_.clear();
+    territoriesById_.clear();
 }
\ No newline at end of file
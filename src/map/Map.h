@@ -1,10 +1,13 @@
 #pragma once
 
+#include "../game_engine/Handles.h"
 #include <iostream>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+class Player;
+
 class Territory
 {
 public:
@@ -15,12 +18,16 @@ public:
     friend bool operator== (const Territory &t1, const Territory &t2);
     friend std::ostream &operator<<(std::ostream &output, const Territory &territory);
     std::string getName() const;
+    TerritoryId getId() const;
     int getNumberOfArmies() const;
     int getPendingIncomingArmies() const;
     int getPendingOutgoingArmies() const;
+    Player* getOwner() const;
     void setName(std::string name);
+    void setId(TerritoryId id);
     void setPendingIncomingArmies(int armies);
     void setPendingOutgoingArmies(int armies);
+    void setOwner(Player* owner);
     void removeArmies(int armies);
     void addArmies(int armies);
     void addPendingIncomingArmies(int armies);
@@ -29,9 +36,11 @@ public:
 
 private:
     std::string name_;
+    TerritoryId id_;
     int numberOfArmies_;
     int pendingIncomingArmies_;
     int pendingOutgoingArmies_;
+    Player* owner_;
 };
 
 class Continent
@@ -63,21 +72,27 @@ public:
     Map();
     Map(std::vector<Continent*> continents, std::unordered_map<Territory*, std::vector<Territory*>> adjacencyList);
     Map(const Map &map);
+    Map(Map &&map) noexcept;
     ~Map();
     const Map &operator=(const Map &map);
+    const Map &operator=(Map &&map) noexcept;
     friend std::ostream &operator<<(std::ostream &output, const Map &map);
     std::unordered_map<Territory*, std::vector<Territory*>> getAdjacencyList() const;
     std::vector<Continent*> getContinents() const;
     std::vector<Territory*> getTerritories() const;
+    int getNumberOfTerritories() const;
+    Territory* getTerritory(TerritoryId id) const;
     std::vector<Territory*> getAdjacentTerritories(Territory* territory);
     bool validate();
 
 private:
     std::vector<Continent*> continents_;
     std::unordered_map<Territory*, std::vector<Territory*>> adjacencyList_;
+    std::vector<Territory*> territoriesById_;
     bool checkGraphValidity_();
     bool checkContinentsValidity_();
     bool checkTerritoriesValidity_();
+    void assignTerritoryIds_();
     void copyMapContents_(const Map &map);
     void destroyMapContents_();
 };
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "MapGenerator.h"
+#include <algorithm>
+#include <utility>
+
+
+/*
+===================================
+ Implementation for MapGenerator class
+===================================
+ */
+
+// Constructors
+MapGenerator::MapGenerator(int width, int height, int continentSize) : width_(width), height_(height), continentSize_(continentSize)
+{
+    if (width < 1 || height < 1 || continentSize < 1)
+    {
+        throw "Generated maps need a positive width, height and continent size.";
+    }
+}
+
+MapGenerator::MapGenerator(const MapGenerator &generator)
+    : width_(generator.width_), height_(generator.height_), continentSize_(generator.continentSize_) {}
+
+// Operator overloading
+const MapGenerator &MapGenerator::operator=(const MapGenerator &generator)
+{
+    if (this != &generator)
+    {
+        width_ = generator.width_;
+        height_ = generator.height_;
+        continentSize_ = generator.continentSize_;
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const MapGenerator &generator)
+{
+    output << "[MapGenerator] " << generator.width_ << "x" << generator.height_ << " grid with continents of up to ";
+    output << generator.continentSize_ << "x" << generator.continentSize_ << " territories";
+    return output;
+}
+
+// Short name describing the generated map, e.g. `grid-32x32`
+std::string MapGenerator::getName() const
+{
+    return "grid-" + std::to_string(width_) + "x" + std::to_string(height_);
+}
+
+// Build the map. Continents are worth half of their territories, like in most of the bundled maps.
+Map* MapGenerator::generateMap() const
+{
+    int continentsPerRow = (width_ + continentSize_ - 1) / continentSize_;
+    int continentsPerColumn = (height_ + continentSize_ - 1) / continentSize_;
+
+    std::vector<Continent*> continents;
+    for (int i = 0; i < continentsPerRow * continentsPerColumn; i++)
+    {
+        continents.push_back(new Continent("Continent " + std::to_string(i + 1), 0));
+    }
+
+    std::vector<Territory*> territories;
+    for (int y = 0; y < height_; y++)
+    {
+        for (int x = 0; x < width_; x++)
+        {
+            Territory* territory = new Territory("Territory " + std::to_string(x) + "-" + std::to_string(y));
+            continents.at((y / continentSize_) * continentsPerRow + x / continentSize_)->addTerritory(territory);
+            territories.push_back(territory);
+        }
+    }
+
+    for (const auto &continent : continents)
+    {
+        continent->setControlValue(std::max(1, static_cast<int>(continent->getTerritories().size()) / 2));
+    }
+
+    std::unordered_map<Territory*, std::vector<Territory*>> adjacencyList;
+    for (int y = 0; y < height_; y++)
+    {
+        for (int x = 0; x < width_; x++)
+        {
+            std::vector<Territory*> &neighbors = adjacencyList[territories.at(y * width_ + x)];
+            if (y > 0)
+            {
+                neighbors.push_back(territories.at((y - 1) * width_ + x));
+            }
+            if (x > 0)
+            {
+                neighbors.push_back(territories.at(y * width_ + x - 1));
+            }
+            if (x < width_ - 1)
+            {
+                neighbors.push_back(territories.at(y * width_ + x + 1));
+            }
+            if (y < height_ - 1)
+            {
+                neighbors.push_back(territories.at((y + 1) * width_ + x));
+            }
+        }
+    }
+
+    return new Map(std::move(continents), std::move(adjacencyList));
+}
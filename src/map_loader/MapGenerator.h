@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../map/Map.h"
+#include <iostream>
+
+
+// Generates rectangular grid maps of any size, for workloads larger than the maps in `resources/`.
+// Every territory borders the territories above, below, left and right of it, and the grid is cut into square continents.
+class MapGenerator
+{
+    public:
+        MapGenerator(int width, int height, int continentSize);
+        MapGenerator(const MapGenerator &generator);
+        const MapGenerator &operator=(const MapGenerator &generator);
+        friend std::ostream &operator<<(std::ostream &output, const MapGenerator &generator);
+        std::string getName() const;
+        Map* generateMap() const;
+
+    private:
+        int width_;
+        int height_;
+        int continentSize_;
+};
@@ -1,8 +1,11 @@
 #include "MapLoader.h"
+#include "../logging/Logger.h"
 #include "../map/Map.h"
+#include "../profiling/AllocationTracker.h"
 #include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <utility>
 
 namespace
 {
@@ -112,7 +115,7 @@ std::vector<Territory*> MapLoader::getTerritories(std::ifstream &stream, std::ve
 }
 
 // Reads the input `.map` file and connects the territories to each other.
-std::unordered_map<Territory*, std::vector<Territory*>> MapLoader::buildAdjacencyList(std::ifstream &stream, std::vector<Territory*> territories)
+std::unordered_map<Territory*, std::vector<Territory*>> MapLoader::buildAdjacencyList(std::ifstream &stream, const std::vector<Territory*> &territories)
 {
     std::unordered_map<Territory*, std::vector<Territory*>> adjacencyList;
     std::string line;
@@ -148,6 +151,7 @@ std::unordered_map<Territory*, std::vector<Territory*>> MapLoader::buildAdjacenc
 // Read the input `.map` file and generate a Map instance.
 Map* MapLoader::loadMap(std::string filename)
 {
+    ALLOCATION_SCOPE(MAP_LOADING_TAG);
     std::ifstream mapFile(filename);
 
     if (mapFile.is_open())
@@ -156,7 +160,7 @@ Map* MapLoader::loadMap(std::string filename)
         std::vector<Territory*> territories = getTerritories(mapFile, continents);
         std::unordered_map<Territory*, std::vector<Territory*>> adjacencyList = buildAdjacencyList(mapFile, territories);
 
-        Map* map = new Map(continents, adjacencyList);
+        Map* map = new Map(std::move(continents), std::move(adjacencyList));
 
         mapFile.close();
 
@@ -167,7 +171,7 @@ Map* MapLoader::loadMap(std::string filename)
             throw "Invalid map structure.";
         }
 
-        std::cout << "Map successfully loaded." << std::endl;
+        LOG_INFO("Map successfully loaded.\n");
         return map;
     }
 
@@ -279,6 +283,7 @@ std::unordered_map<Territory*, std::vector<Territory*>> ConquestFileReader::buil
 // Read the input `.map` conquest file and generate a Map instance.
 Map* ConquestFileReader::readConquestFile(std::string filename)
 {
+    ALLOCATION_SCOPE(MAP_LOADING_TAG);
     std::ifstream mapFile(filename);
 
     if (mapFile.is_open())
@@ -292,7 +297,7 @@ Map* ConquestFileReader::readConquestFile(std::string filename)
             continents.push_back(entry.second);
         }
 
-        Map* map = new Map(continents, adjacencyList);
+        Map* map = new Map(std::move(continents), std::move(adjacencyList));
 
         mapFile.close();
 
@@ -303,7 +308,7 @@ Map* ConquestFileReader::readConquestFile(std::string filename)
             throw "Invalid map structure.";
         }
 
-        std::cout << "Map successfully loaded." << std::endl;
+        LOG_INFO("Map successfully loaded.\n");
         return map;
     }
 
@@ -320,7 +325,7 @@ Map* ConquestFileReader::readConquestFile(std::string filename)
 // Constructors
 ConquestFileReaderAdapter::ConquestFileReaderAdapter() : fileReader_(new ConquestFileReader()) {}
 
-ConquestFileReaderAdapter::ConquestFileReaderAdapter(const ConquestFileReaderAdapter &adapter) : fileReader_(new ConquestFileReader()) {}
+ConquestFileReaderAdapter::ConquestFileReaderAdapter(const ConquestFileReaderAdapter &) : fileReader_(new ConquestFileReader()) {}
 
 // Destructor
 ConquestFileReaderAdapter::~ConquestFileReaderAdapter()
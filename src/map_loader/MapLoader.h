@@ -15,7 +15,7 @@ class MapLoader
     private:
         std::vector<Continent*> getContinents(std::ifstream &stream);
         std::vector<Territory*> getTerritories(std::ifstream &stream, std::vector<Continent*> &continents);
-        std::unordered_map<Territory*, std::vector<Territory*>> buildAdjacencyList(std::ifstream &stream, std::vector<Territory*> territories);
+        std::unordered_map<Territory*, std::vector<Territory*>> buildAdjacencyList(std::ifstream &stream, const std::vector<Territory*> &territories);
 };
 
 class ConquestFileReader
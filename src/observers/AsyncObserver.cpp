@@ -0,0 +1,231 @@
+#include "AsyncObserver.h"
+#include "../map/Map.h"
+#include <utility>
+
+namespace
+{
+    const std::string PHASE_NAMES[] = { "Startup", "Reinforcement", "Issue orders", "Execute orders", "None" };
+    const std::string ORDER_NAMES[] = { "Deploy", "Advance", "Bomb", "Blockade", "Airlift", "Negotiate" };
+    const std::string CARD_NAMES[] = { "Bomb", "Reinforcement", "Blockade", "Airlift", "Diplomacy" };
+    const std::string POLICY_NAMES[] = { "block when full", "drop when full", "sample when busy" };
+
+    const int DEFAULT_CAPACITY = 4096;
+}
+
+// Output one line describing the event
+std::ostream &operator<<(std::ostream &output, const ObservedEvent &event)
+{
+    switch (event.type)
+    {
+        case PHASE_CHANGED_EVENT:
+            output << "[Phase] " << PHASE_NAMES[event.phase];
+            if (!event.player.empty())
+            {
+                output << ": " << event.player << " (" << event.territories << " territories, " << event.reinforcements;
+                output << " reinforcements, " << event.orders << " orders, " << event.cards << " cards)";
+            }
+            break;
+
+        case ORDER_EXECUTED_EVENT:
+            output << "[Order] " << event.player << " executed " << ORDER_NAMES[event.orderType];
+            break;
+
+        case TERRITORY_CAPTURED_EVENT:
+            output << "[Capture] " << event.territory << ": " << event.previousOwner << " -> " << event.player;
+            output << " (" << event.territories << " territories)";
+            break;
+
+        case PLAYER_ELIMINATED_EVENT:
+            output << "[Elimination] " << event.player;
+            break;
+
+        case CARD_DRAWN_EVENT:
+            output << "[Card] " << event.player << " drew " << CARD_NAMES[event.cardType] << " (" << event.cards << " cards)";
+            break;
+    }
+    return output;
+}
+
+
+/*
+===================================
+ Implementation for AsyncObserver class
+===================================
+ */
+
+// Constructors
+AsyncObserver::AsyncObserver(Subject* subject)
+    : AsyncObserver(subject, [](const ObservedEvent &event) { std::cout << event << std::endl; }, DEFAULT_CAPACITY, DROP_WHEN_FULL) {}
+
+AsyncObserver::AsyncObserver(Subject* subject, std::function<void(const ObservedEvent &event)> sink, int capacity,
+                             BackpressurePolicy policy, int sampleRate)
+    : Observer(subject), sink_(sink), policy_(policy), sampleRate_(sampleRate), queue_(capacity), eventsQueued_(0),
+      eventsDropped_(0), eventsSampled_(0), waits_(0), queueSignal_(0), eventsOutput_(0), stopping_(false)
+{
+    if (sampleRate < 1)
+    {
+        throw "An asynchronous observer must keep at least one event in every `sampleRate` when sampling.";
+    }
+    dispatcher_ = std::thread(&AsyncObserver::dispatch_, this);
+}
+
+// Destructor
+AsyncObserver::~AsyncObserver()
+{
+    stopping_.store(true, std::memory_order_release);
+    queueSignal_.fetch_add(1, std::memory_order_release);
+    queueSignal_.notify_one();
+    dispatcher_.join();
+}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const AsyncObserver &observer)
+{
+    output << "[AsyncObserver] " << POLICY_NAMES[observer.policy_] << ", " << observer.queue_.getCapacity() << " events queued at most, ";
+    output << observer.eventsQueued_ << " queued, " << observer.eventsDropped_ << " dropped, " << observer.waits_ << " waits";
+    return output;
+}
+
+// Queue a copy of every event of the game
+void AsyncObserver::subscribe(EventBus &events)
+{
+    events.subscribe<PhaseChanged>(this, [this](const PhaseChanged &event) {
+        ObservedEvent observed = describe_(PHASE_CHANGED_EVENT, event.activePlayer);
+        observed.phase = event.phase;
+        observed.reinforcements = event.reinforcements;
+        observed.orders = event.orders;
+        observed.cards = event.cards;
+        enqueue_(std::move(observed));
+    });
+    events.subscribe<OrderExecuted>(this, [this](const OrderExecuted &event) {
+        ObservedEvent observed = describe_(ORDER_EXECUTED_EVENT, event.player);
+        observed.orderType = event.order->getType();
+        enqueue_(std::move(observed));
+    });
+    events.subscribe<TerritoryCaptured>(this, [this](const TerritoryCaptured &event) {
+        ObservedEvent observed = describe_(TERRITORY_CAPTURED_EVENT, event.newOwner);
+        observed.territory = event.territory->getName();
+        observed.previousOwner = event.previousOwner == nullptr ? "nobody" : event.previousOwner->getName();
+        enqueue_(std::move(observed));
+    });
+    events.subscribe<PlayerEliminated>(this, [this](const PlayerEliminated &event) {
+        enqueue_(describe_(PLAYER_ELIMINATED_EVENT, event.player));
+    });
+    events.subscribe<CardDrawn>(this, [this](const CardDrawn &event) {
+        ObservedEvent observed = describe_(CARD_DRAWN_EVENT, event.player);
+        observed.cardType = event.card->getType();
+        enqueue_(std::move(observed));
+    });
+}
+
+// Wait until the dispatcher thread has output every event queued so far
+void AsyncObserver::flush()
+{
+    unsigned int eventsOutput = eventsOutput_.load(std::memory_order_acquire);
+    while (eventsOutput != static_cast<unsigned int>(eventsQueued_))
+    {
+        eventsOutput_.wait(eventsOutput, std::memory_order_acquire);
+        eventsOutput = eventsOutput_.load(std::memory_order_acquire);
+    }
+}
+
+// Getters
+BackpressurePolicy AsyncObserver::getPolicy() const
+{
+    return policy_;
+}
+
+long AsyncObserver::getNumberOfEventsQueued() const
+{
+    return eventsQueued_;
+}
+
+long AsyncObserver::getNumberOfEventsDropped() const
+{
+    return eventsDropped_;
+}
+
+// Number of events the publishing thread had to wait for room in the queue for
+long AsyncObserver::getNumberOfWaits() const
+{
+    return waits_;
+}
+
+// Put the event in the queue, or drop it or wait for room, depending on the policy. Waking up the dispatcher thread only
+// costs a system call when it is asleep.
+void AsyncObserver::enqueue_(ObservedEvent &&event)
+{
+    if (policy_ == SAMPLE_WHEN_BUSY && queue_.getSize() >= queue_.getCapacity() / 2 && eventsSampled_++ % sampleRate_ != 0)
+    {
+        eventsDropped_++;
+        return;
+    }
+
+    unsigned int eventsOutput = eventsOutput_.load(std::memory_order_acquire);
+    bool waited = false;
+    while (!queue_.tryPush(std::move(event)))
+    {
+        if (policy_ != BLOCK_WHEN_FULL)
+        {
+            eventsDropped_++;
+            return;
+        }
+
+        waits_ += waited ? 0 : 1;
+        waited = true;
+        eventsOutput_.wait(eventsOutput, std::memory_order_acquire);
+        eventsOutput = eventsOutput_.load(std::memory_order_acquire);
+    }
+
+    eventsQueued_++;
+    queueSignal_.fetch_add(1, std::memory_order_release);
+    queueSignal_.notify_one();
+}
+
+// Output the queued events until the observer is destroyed, sleeping while the queue is empty. Reading the signal before
+// trying the queue means an event queued in between wakes the thread right back up.
+void AsyncObserver::dispatch_()
+{
+    ObservedEvent event;
+    while (true)
+    {
+        unsigned int queueSignal = queueSignal_.load(std::memory_order_acquire);
+        if (queue_.tryPop(event))
+        {
+            sink_(event);
+            eventsOutput_.fetch_add(1, std::memory_order_release);
+            eventsOutput_.notify_all();
+        }
+        else if (stopping_.load(std::memory_order_acquire))
+        {
+            break;
+        }
+        else
+        {
+            queueSignal_.wait(queueSignal, std::memory_order_acquire);
+        }
+    }
+
+    // Events queued right before the observer was destroyed
+    while (queue_.tryPop(event))
+    {
+        sink_(event);
+        eventsOutput_.fetch_add(1, std::memory_order_release);
+    }
+}
+
+// Copy what observers display about `player` out of the game
+ObservedEvent AsyncObserver::describe_(ObservedEventType type, Player* player)
+{
+    ObservedEvent event;
+    event.type = type;
+    if (player != nullptr)
+    {
+        event.player = player->getName();
+        event.territories = player->getNumberOfOwnedTerritories();
+        event.reinforcements = player->getReinforcements();
+        event.orders = player->getNumberOfOrders();
+        event.cards = player->getNumberOfCards();
+    }
+    return event;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "../cards/Cards.h"
+#include "../orders/Orders.h"
+#include "GameObservers.h"
+#include "RingBuffer.h"
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+
+enum ObservedEventType : short
+{
+    PHASE_CHANGED_EVENT,
+    ORDER_EXECUTED_EVENT,
+    TERRITORY_CAPTURED_EVENT,
+    PLAYER_ELIMINATED_EVENT,
+    CARD_DRAWN_EVENT
+};
+
+// What to do with an event when the dispatcher thread falls behind:
+// - BLOCK_WHEN_FULL: wait for room in the queue, so that no event is lost
+// - DROP_WHEN_FULL: drop the event if the queue is full
+// - SAMPLE_WHEN_BUSY: once the queue is half full, keep only one event in every few, and drop the event if it is full
+enum BackpressurePolicy : short
+{
+    BLOCK_WHEN_FULL,
+    DROP_WHEN_FULL,
+    SAMPLE_WHEN_BUSY
+};
+
+// A game event copied out of the game when it is published, so that it can be output on another thread while the game
+// moves on and players get eliminated. `player` is the active, executing, capturing, eliminated or drawing player, and
+// the numbers describe that player at the time of the event.
+struct ObservedEvent
+{
+    ObservedEventType type = PHASE_CHANGED_EVENT;
+    Phase phase = NONE;
+    std::string player;
+    std::string previousOwner;
+    std::string territory;
+    OrderType orderType = DEPLOY;
+    CardType cardType = BOMB_CARD;
+    int territories = 0;
+    int reinforcements = 0;
+    int orders = 0;
+    int cards = 0;
+};
+
+std::ostream &operator<<(std::ostream &output, const ObservedEvent &event);
+
+
+// Outputs the events of a game on a dedicated dispatcher thread, so that the game never waits on a slow console or file
+// unless it asks to. Events go through a bounded single-producer queue: they must all be published from one thread at a
+// time, which the game engine does. `sink` is called on the dispatcher thread, one event at a time, in the order the
+// events were published. The observer finishes outputting the events it queued before it is destroyed.
+class AsyncObserver : public Observer
+{
+    public:
+        AsyncObserver(Subject* subject);
+        AsyncObserver(Subject* subject, std::function<void(const ObservedEvent &event)> sink, int capacity,
+                      BackpressurePolicy policy, int sampleRate = 10);
+        AsyncObserver(const AsyncObserver &observer) = delete;
+        ~AsyncObserver();
+        const AsyncObserver &operator=(const AsyncObserver &observer) = delete;
+        friend std::ostream &operator<<(std::ostream &output, const AsyncObserver &observer);
+        void subscribe(EventBus &events);
+        void flush();
+        BackpressurePolicy getPolicy() const;
+        long getNumberOfEventsQueued() const;
+        long getNumberOfEventsDropped() const;
+        long getNumberOfWaits() const;
+
+    private:
+        std::function<void(const ObservedEvent &event)> sink_;
+        BackpressurePolicy policy_;
+        int sampleRate_;
+        RingBuffer<ObservedEvent> queue_;
+
+        // Only touched by the publishing thread
+        long eventsQueued_;
+        long eventsDropped_;
+        long eventsSampled_;
+        long waits_;
+
+        // Bumped by the publishing thread after queueing an event and by the dispatcher thread after outputting one, for
+        // the other side to wait on
+        std::atomic<unsigned int> queueSignal_;
+        std::atomic<unsigned int> eventsOutput_;
+        std::atomic<bool> stopping_;
+        std::thread dispatcher_;
+
+        void enqueue_(ObservedEvent &&event);
+        void dispatch_();
+        static ObservedEvent describe_(ObservedEventType type, Player* player);
+};
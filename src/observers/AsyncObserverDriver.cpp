@@ -0,0 +1,160 @@
+#include "AsyncObserver.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // How long the slow sink takes to output an event, like a busy terminal or a file on a slow disk would
+    const std::chrono::microseconds SLOW_OUTPUT(50);
+
+    struct GameRun
+    {
+        double gameSeconds;
+        double outputSeconds;
+        long eventsPublished;
+        std::vector<std::string> lines;
+    };
+
+    void setupGame(GameEngine &)
+    {
+        MapLoader loader;
+        GameEngine::setDeck(new Deck());
+        GameEngine::getDeck()->generateCards(50);
+        GameEngine::setMap(loader.loadMap("resources/canada.map"));
+        GameEngine::setPlayers({
+            new Player("Aggressive", new AggressivePlayerStrategy()),
+            new Player("Aggressive 2", new AggressivePlayerStrategy()),
+            new Player("Benevolent", new BenevolentPlayerStrategy())
+        });
+        GameEngine::setSeed(42);
+    }
+
+    // Count every event the game publishes, on the game thread
+    void countEvents(GameEngine &gameEngine, long &events)
+    {
+        EventBus &bus = gameEngine.getEvents();
+        bus.subscribe<PhaseChanged>(&events, [&events](const PhaseChanged &) { events++; });
+        bus.subscribe<OrderExecuted>(&events, [&events](const OrderExecuted &) { events++; });
+        bus.subscribe<TerritoryCaptured>(&events, [&events](const TerritoryCaptured &) { events++; });
+        bus.subscribe<PlayerEliminated>(&events, [&events](const PlayerEliminated &) { events++; });
+        bus.subscribe<CardDrawn>(&events, [&events](const CardDrawn &) { events++; });
+    }
+
+    // Play a game with an observer outputting its events through `sink`, and time the game apart from the events still
+    // being output once it is over
+    GameRun playGame(std::function<void(const ObservedEvent &event)> sink, int capacity, BackpressurePolicy policy, std::ostream &report)
+    {
+        GameRun run{ 0, 0, 0, {} };
+        GameEngine gameEngine;
+        setupGame(gameEngine);
+        countEvents(gameEngine, run.eventsPublished);
+        AsyncObserver* observer = new AsyncObserver(&gameEngine, [&run, sink](const ObservedEvent &event) {
+            sink(event);
+            std::ostringstream line;
+            line << event;
+            run.lines.push_back(line.str());
+        }, capacity, policy);
+        gameEngine.attach(observer);
+
+        auto start = std::chrono::steady_clock::now();
+        gameEngine.startupPhase();
+        while (gameEngine.getRound() < 100 && gameEngine.playRound()) {}
+        auto gameOver = std::chrono::steady_clock::now();
+        observer->flush();
+        auto outputDone = std::chrono::steady_clock::now();
+
+        run.gameSeconds = std::chrono::duration<double>(gameOver - start).count();
+        run.outputSeconds = std::chrono::duration<double>(outputDone - gameOver).count();
+        report << *observer;
+        gameEngine.detach(observer);
+        gameEngine.getEvents().unsubscribe(&run.eventsPublished);
+        GameEngine::resetGameEngine();
+
+        return run;
+    }
+
+    // Play the same game with the slow sink called right away on the game thread
+    double playSynchronousGame(long &eventsPublished)
+    {
+        GameEngine gameEngine;
+        setupGame(gameEngine);
+        EventBus &bus = gameEngine.getEvents();
+        auto slowOutput = [&eventsPublished](const auto &) {
+            eventsPublished++;
+            std::this_thread::sleep_for(SLOW_OUTPUT);
+        };
+        bus.subscribe<PhaseChanged>(&eventsPublished, slowOutput);
+        bus.subscribe<OrderExecuted>(&eventsPublished, slowOutput);
+        bus.subscribe<TerritoryCaptured>(&eventsPublished, slowOutput);
+        bus.subscribe<PlayerEliminated>(&eventsPublished, slowOutput);
+        bus.subscribe<CardDrawn>(&eventsPublished, slowOutput);
+
+        auto start = std::chrono::steady_clock::now();
+        gameEngine.startupPhase();
+        while (gameEngine.getRound() < 100 && gameEngine.playRound()) {}
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        bus.unsubscribe(&eventsPublished);
+        GameEngine::resetGameEngine();
+        return seconds;
+    }
+}
+
+int main()
+{
+    if constexpr (!EVENTS_ENABLED)
+    {
+        std::cout << "Game events are compiled out. Reconfigure with -DWARZONE_OBSERVERS=ON to publish them." << std::endl;
+        return 0;
+    }
+
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+    std::cout << std::fixed << std::setprecision(1);
+
+    long eventsPublished = 0;
+    double synchronousSeconds = playSynchronousGame(eventsPublished);
+    std::cout << "Synchronous slow output: " << eventsPublished << " events, game took " << 1000 * synchronousSeconds << " ms" << std::endl;
+
+    // Every event, in order, when the game waits for room in the queue
+    auto fastSink = [](const ObservedEvent &) {};
+    auto slowSink = [](const ObservedEvent &) { std::this_thread::sleep_for(SLOW_OUTPUT); };
+    GameRun reference = playGame(fastSink, 4096, BLOCK_WHEN_FULL, std::cout);
+    std::cout << std::endl;
+    bool consistent = reference.eventsPublished == eventsPublished && (long)reference.lines.size() == eventsPublished;
+
+    std::vector<std::pair<std::string, BackpressurePolicy>> policies = {
+        { "Block when full", BLOCK_WHEN_FULL },
+        { "Drop when full", DROP_WHEN_FULL },
+        { "Sample when busy", SAMPLE_WHEN_BUSY }
+    };
+    for (const auto &policy : policies)
+    {
+        std::ostringstream report;
+        GameRun run = playGame(slowSink, 256, policy.second, report);
+        std::cout << "Asynchronous slow output, " << policy.first << ": game took " << 1000 * run.gameSeconds << " ms, ";
+        std::cout << "output finished " << 1000 * run.outputSeconds << " ms later" << std::endl;
+        std::cout << "  " << report.str() << ", " << run.lines.size() << " output" << std::endl;
+
+        // Whatever the policy, the events that were output are the game's events in the order they were published
+        auto next = reference.lines.begin();
+        for (const auto &line : run.lines)
+        {
+            next = find(next, reference.lines.end(), line);
+            consistent = consistent && next != reference.lines.end();
+            next += next != reference.lines.end() ? 1 : 0;
+        }
+        consistent = consistent && (policy.second != BLOCK_WHEN_FULL || run.lines == reference.lines);
+    }
+
+    std::cout << (consistent ? "Output events match the game." : "Output events DO NOT match the game.") << std::endl;
+    return consistent ? 0 : 1;
+}
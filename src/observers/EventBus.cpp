@@ -0,0 +1,33 @@
+#include "EventBus.h"
+#include <algorithm>
+
+
+/*
+===================================
+ Implementation for EventBus class
+===================================
+ */
+
+// Constructor
+EventBus::EventBus() {}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const EventBus &bus)
+{
+    output << "[EventBus] " << bus.getNumberOfHandlers_() << " handlers";
+    return output;
+}
+
+// Stop calling the handlers `subscriber` subscribed with, for every event type
+void EventBus::unsubscribe(const void* subscriber)
+{
+    std::apply([subscriber](auto &... handlers) {
+        auto isSubscriber = [subscriber](const auto &handler) { return handler.first == subscriber; };
+        (handlers.erase(remove_if(handlers.begin(), handlers.end(), isSubscriber), handlers.end()), ...);
+    }, handlers_);
+}
+
+int EventBus::getNumberOfHandlers_() const
+{
+    return std::apply([](const auto &... handlers) { return (static_cast<int>(handlers.size()) + ...); }, handlers_);
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "../profiling/AllocationTracker.h"
+#include "../profiling/Profiler.h"
+#include "../profiling/Tracer.h"
+#include <functional>
+#include <iostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+class Card;
+class Order;
+class Player;
+class Territory;
+
+// Game events are compiled in unless the `WARZONE_OBSERVERS` CMake option is turned off. Headless builds then compile
+// every publish() away, along with whatever its caller only does when hasSubscribers(): publishers that have to do some
+// work to put an event together, like looking up a player's state, only do it when hasSubscribers().
+#ifdef WARZONE_HEADLESS
+constexpr bool EVENTS_ENABLED = false;
+#else
+constexpr bool EVENTS_ENABLED = true;
+#endif
+
+enum Phase : short
+{
+    STARTUP,
+    REINFORCEMENT,
+    ISSUE_ORDERS,
+    EXECUTE_ORDERS,
+    NONE
+};
+
+// The game moved to `phase`, or `activePlayer` took its turn in it. `activePlayer` is nullptr between turns.
+// The counts are what `activePlayer` had as its turn started, which may differ from its current state: players issuing
+// concurrently have all taken their turns by the time they are published, and orders are taken out of the players' lists
+// before they are executed. `orders` is the number of orders issued so far when issuing orders, and left to execute when
+// executing them.
+struct PhaseChanged
+{
+    Phase phase;
+    Player* activePlayer;
+    int orders = 0;
+    int reinforcements = 0;
+    int cards = 0;
+};
+
+// `player` executed `order`
+struct OrderExecuted
+{
+    Player* player;
+    Order* order;
+};
+
+// `territory` went from `previousOwner` to `newOwner`, e.g. conquered by an advance or handed to the Neutral Player
+struct TerritoryCaptured
+{
+    Territory* territory;
+    Player* previousOwner;
+    Player* newOwner;
+};
+
+// `player` owns no territories anymore and is about to be removed from the game
+struct PlayerEliminated
+{
+    Player* player;
+};
+
+// `player` drew `card` from the deck after conquering a territory
+struct CardDrawn
+{
+    Player* player;
+    const Card* card;
+};
+
+
+// Delivers the events of a game to the handlers subscribed to their type. Each event type has its own list of handlers,
+// picked at compile time, so publishing an event nobody subscribed to only checks that its list is empty. Publishers
+// whose events are costly to put together can check hasSubscribers() first.
+// Subscribing to a headless build's bus does nothing, so observers can still be attached to it.
+// Handlers are called in the order they subscribed, on the thread publishing the event, and must not subscribe or
+// unsubscribe while an event is being published. An EventBus calls back into its subscribers, so it cannot be copied.
+class EventBus
+{
+public:
+    EventBus();
+    EventBus(const EventBus &bus) = delete;
+    const EventBus &operator=(const EventBus &bus) = delete;
+    friend std::ostream &operator<<(std::ostream &output, const EventBus &bus);
+    template <typename Event> void subscribe(const void* subscriber, std::function<void(const Event &event)> handler);
+    void unsubscribe(const void* subscriber);
+    template <typename Event> bool hasSubscribers() const;
+    template <typename Event> void publish(const Event &event) const;
+
+private:
+    template <typename Event>
+    using Handlers = std::vector<std::pair<const void*, std::function<void(const Event &event)>>>;
+
+    std::tuple<Handlers<PhaseChanged>, Handlers<OrderExecuted>, Handlers<TerritoryCaptured>, Handlers<PlayerEliminated>,
+               Handlers<CardDrawn>> handlers_;
+    int getNumberOfHandlers_() const;
+};
+
+
+// Call `handler` with every event of type `Event` published from now on, until `subscriber` unsubscribes
+template <typename Event>
+void EventBus::subscribe(const void* subscriber, std::function<void(const Event &event)> handler)
+{
+    if constexpr (EVENTS_ENABLED)
+    {
+        std::get<Handlers<Event>>(handlers_).push_back({ subscriber, handler });
+    }
+}
+
+template <typename Event>
+bool EventBus::hasSubscribers() const
+{
+    if constexpr (!EVENTS_ENABLED)
+    {
+        return false;
+    }
+    else
+    {
+        return !std::get<Handlers<Event>>(handlers_).empty();
+    }
+}
+
+template <typename Event>
+void EventBus::publish(const Event &event) const
+{
+    if constexpr (!EVENTS_ENABLED)
+    {
+        return;
+    }
+
+    const Handlers<Event> &handlers = std::get<Handlers<Event>>(handlers_);
+    if (handlers.empty())
+    {
+        return;
+    }
+
+    PROFILE_SCOPE(OBSERVERS_SECTION);
+    ALLOCATION_SCOPE(OBSERVERS_TAG);
+    for (const auto &handler : handlers)
+    {
+        TRACE_SCOPE("EventBus::publish", "observer");
+        handler.second(event);
+    }
+}
@@ -0,0 +1,102 @@
+#include "EventBus.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapLoader.h"
+#include <chrono>
+#include <map>
+#include <string>
+
+namespace
+{
+    // Count the events of every type published during a game, and check them against the state of the game
+    bool countEvents()
+    {
+        MapLoader loader;
+        GameEngine gameEngine;
+        GameEngine::setDeck(new Deck());
+        GameEngine::getDeck()->generateCards(50);
+        GameEngine::setMap(loader.loadMap("resources/canada.map"));
+        GameEngine::setPlayers({
+            new Player("Aggressive", new AggressivePlayerStrategy()),
+            new Player("Aggressive 2", new AggressivePlayerStrategy()),
+            new Player("Benevolent", new BenevolentPlayerStrategy())
+        });
+        GameEngine::setSeed(42);
+
+        std::map<std::string, int> counts;
+        std::map<Player*, int> territoriesCaptured;
+        EventBus &events = gameEngine.getEvents();
+        events.subscribe<PhaseChanged>(&counts, [&counts](const PhaseChanged &) { counts["PhaseChanged"]++; });
+        events.subscribe<OrderExecuted>(&counts, [&counts](const OrderExecuted &) { counts["OrderExecuted"]++; });
+        events.subscribe<PlayerEliminated>(&counts, [&counts](const PlayerEliminated &event) {
+            counts["PlayerEliminated"]++;
+            // The Neutral Player joins when a blockade is set up, and is eliminated once it loses its territories
+            counts["NeutralPlayerEliminated"] += event.player->isNeutral() ? 1 : 0;
+        });
+        events.subscribe<CardDrawn>(&counts, [&counts](const CardDrawn &) { counts["CardDrawn"]++; });
+        events.subscribe<TerritoryCaptured>(&counts, [&counts, &territoriesCaptured](const TerritoryCaptured &event) {
+            counts["TerritoryCaptured"]++;
+            territoriesCaptured[event.newOwner]++;
+        });
+        std::cout << events << std::endl;
+
+        gameEngine.startupPhase();
+        while (gameEngine.getRound() < 100 && gameEngine.playRound()) {}
+
+        std::cout << "After " << gameEngine.getRound() << " rounds (" << StalemateDetector::getReasonName(gameEngine.getEndReason()) << "):" << std::endl;
+        for (const auto &count : counts)
+        {
+            std::cout << "  " << count.first << ": " << count.second << std::endl;
+        }
+
+        int playersLeft = 0;
+        for (const auto &player : GameEngine::getPlayers())
+        {
+            playersLeft += player->isNeutral() ? 0 : 1;
+            std::cout << "  " << player->getName() << " captured " << territoriesCaptured[player] << " territories" << std::endl;
+        }
+        bool consistent = counts["OrderExecuted"] == gameEngine.getNumberOfOrdersExecuted() && counts["PlayerEliminated"] - counts["NeutralPlayerEliminated"] == 3 - playersLeft;
+
+        events.unsubscribe(&counts);
+        std::cout << events << std::endl;
+        GameEngine::resetGameEngine();
+
+        return consistent;
+    }
+
+    // Publishing an event nobody subscribed to only checks that the list of its handlers is empty
+    void timeUnsubscribedPublishing()
+    {
+        EventBus events;
+        int phaseChanges = 0;
+        events.subscribe<PhaseChanged>(&phaseChanges, [&phaseChanges](const PhaseChanged &) { phaseChanges++; });
+
+        const int NUMBER_OF_EVENTS = 10000000;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUMBER_OF_EVENTS; i++)
+        {
+            events.publish(OrderExecuted{ nullptr, nullptr });
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << NUMBER_OF_EVENTS << " OrderExecuted events without subscribers published in " << 1000 * seconds << " ms" << std::endl;
+    }
+}
+
+int main()
+{
+    if constexpr (!EVENTS_ENABLED)
+    {
+        std::cout << "Game events are compiled out. Reconfigure with -DWARZONE_OBSERVERS=ON to publish them." << std::endl;
+        return 0;
+    }
+
+    // Keep the game output off the console
+    Logger::setLevel(OFF_LEVEL);
+
+    bool consistent = countEvents();
+    timeUnsubscribedPublishing();
+
+    std::cout << (consistent ? "Events match the game." : "Events DO NOT match the game.") << std::endl;
+    return consistent ? 0 : 1;
+}
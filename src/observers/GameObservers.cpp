@@ -1,5 +1,4 @@
 #include "GameObservers.h"
-#include <algorithm>
 #include <iomanip>
 
 #ifdef WIN32
@@ -10,16 +9,16 @@ namespace
 {
     // Color codes to make console output more distinct
     #ifndef WIN32
-        const std::unordered_map<int, string> PLAYER_COLOR_CODES{
+        const std::unordered_map<int, std::string> PLAYER_COLOR_CODES{
             {0, "\e[0;31m"},
             {1, "\e[0;32m"},
             {2, "\e[0;33m"},
             {3, "\e[0;34m"},
             {4, "\e[0;36m"}
         };
-        const string WHITE_COLOR_CODE = "\e[0;37m";
-        const string WHITE_BOLD_COLOR_CODE = "\e[1;37m";
-        const string RESET_COLOR_CODE = "\e[0m";
+        const std::string WHITE_COLOR_CODE = "\e[0;37m";
+        const std::string WHITE_BOLD_COLOR_CODE = "\e[1;37m";
+        const std::string RESET_COLOR_CODE = "\e[0m";
     #else
         const std::unordered_map<int, int> WINDOWS_PLAYER_COLOR_CODES{
             {0, 1},
@@ -33,11 +32,11 @@ namespace
         const HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
     #endif
 
-    // Helper function to change the output text color based on the current active player
-    void setPlayerColorCode(Player* player, std::vector<Player*> allPlayers)
+    // Helper function to change the output text color based on the current active player. Colors repeat every 5 players.
+    // A player's color is picked by id, which players are given in the order they join, so it stays the same all game.
+    void setPlayerColorCode(Player* player)
     {
-        auto iterator = find(allPlayers.begin(), allPlayers.end(), player);
-        int playerIndex = iterator - allPlayers.begin();
+        int playerIndex = player->getId();
         #ifdef WIN32
             int colorCode = 0;
             if (player->isNeutral())
@@ -46,7 +45,7 @@ namespace
             }
             else
             {
-                colorCode = WINDOWS_PLAYER_COLOR_CODES.at(playerIndex);
+                colorCode = WINDOWS_PLAYER_COLOR_CODES.at(playerIndex % WINDOWS_PLAYER_COLOR_CODES.size());
             }
             SetConsoleTextAttribute(hConsole, colorCode);
         #else
@@ -54,7 +53,7 @@ namespace
             {
                 std::cout << WHITE_COLOR_CODE;
             }
-            std::cout << PLAYER_COLOR_CODES.at(playerIndex);
+            std::cout << PLAYER_COLOR_CODES.at(playerIndex % PLAYER_COLOR_CODES.size());
         #endif
     }
 
@@ -113,12 +112,12 @@ const Observer &Observer::operator=(const Observer &observer)
  */
 
 // Constructors
-PhaseObserver::PhaseObserver() : Observer(), lastPhase_(NONE), lastActivePlayer_(nullptr) {}
+PhaseObserver::PhaseObserver() : Observer(), lastPhase_(NONE), lastActivePlayerId_(NO_PLAYER_ID) {}
 
-PhaseObserver::PhaseObserver(Subject* subject) : Observer(subject), lastPhase_(NONE), lastActivePlayer_(nullptr) {}
+PhaseObserver::PhaseObserver(Subject* subject) : Observer(subject), lastPhase_(NONE), lastActivePlayerId_(NO_PLAYER_ID) {}
 
 PhaseObserver::PhaseObserver(const PhaseObserver &observer)
-    : Observer(observer), lastPhase_(observer.lastPhase_), lastActivePlayer_(observer.lastActivePlayer_) {}
+    : Observer(observer), lastPhase_(observer.lastPhase_), lastActivePlayerId_(observer.lastActivePlayerId_) {}
 
 // Assignment operator overloading
 const PhaseObserver &PhaseObserver::operator=(const PhaseObserver &observer)
@@ -127,27 +126,30 @@ const PhaseObserver &PhaseObserver::operator=(const PhaseObserver &observer)
     {
         Observer::operator=(observer);
         lastPhase_ = observer.lastPhase_;
-        lastActivePlayer_ = observer.lastActivePlayer_;
+        lastActivePlayerId_ = observer.lastActivePlayerId_;
     }
     return *this;
 }
 
-// Update observer
-void PhaseObserver::update()
+// Display every phase and every turn taken in it, once. The active player is remembered by id, since it may be eliminated
+// before the next phase.
+void PhaseObserver::subscribe(EventBus &events)
 {
-    if (stateChanged_())
-    {
-        display();
-        saveState_();
-    }
+    events.subscribe<PhaseChanged>(this, [this](const PhaseChanged &event) {
+        PlayerId activePlayerId = event.activePlayer == nullptr ? NO_PLAYER_ID : event.activePlayer->getId();
+        if (lastPhase_ != event.phase || lastActivePlayerId_ != activePlayerId)
+        {
+            display(event);
+            lastPhase_ = event.phase;
+            lastActivePlayerId_ = activePlayerId;
+        }
+    });
 }
 
-// Output the subject state to console
-void PhaseObserver::display() const
+// Output the phase and the active player to console
+void PhaseObserver::display(const PhaseChanged &event) const
 {
-    Phase currentPhase = subject_->getPhase();
-
-    if (currentPhase == STARTUP)
+    if (event.phase == STARTUP)
     {
         setBold();
         std::cout << "\n===========================================" << std::endl;
@@ -160,35 +162,35 @@ void PhaseObserver::display() const
         std::string phaseTitle;
         std::string phaseBody;
 
-        Player* currentActivePlayer = subject_->getActivePlayer();
+        Player* currentActivePlayer = event.activePlayer;
         if (currentActivePlayer != nullptr && !currentActivePlayer->isNeutral())
         {
-            setPlayerColorCode(currentActivePlayer, subject_->getCurrentPlayers());
-            switch (subject_->getPhase())
+            setPlayerColorCode(currentActivePlayer);
+            switch (event.phase)
             {
                 case REINFORCEMENT:
                     std::cout << "\n===========================================" << std::endl;
                     std::cout << "       " << currentActivePlayer->getName() << " : REINFORCEMENT PHASE" << std::endl;
                     std::cout << "===========================================" << std::endl;
-                    std::cout << "Number of territories controlled: " << currentActivePlayer->getOwnedTerritories().size() << std::endl;
-                    std::cout << "Reinforcements: " << currentActivePlayer->getReinforcements() << std::endl;
+                    std::cout << "Number of territories controlled: " << currentActivePlayer->getNumberOfOwnedTerritories() << std::endl;
+                    std::cout << "Reinforcements: " << event.reinforcements << std::endl;
                     break;
                     
                 case ISSUE_ORDERS:
                     std::cout << "\n===========================================" << std::endl;
                     std::cout << "       " << currentActivePlayer->getName() << " : ISSUE ORDERS PHASE" << std::endl;
                     std::cout << "===========================================" << std::endl;
-                    std::cout << "Orders placed: " << currentActivePlayer->getOrdersList().size() << std::endl;
-                    std::cout << "Cards in hand: " << currentActivePlayer->getHand().size() << std::endl;
-                    std::cout << "Reinforcements left: " << currentActivePlayer->getReinforcements() << std::endl;
+                    std::cout << "Orders placed: " << event.orders << std::endl;
+                    std::cout << "Cards in hand: " << event.cards << std::endl;
+                    std::cout << "Reinforcements left: " << event.reinforcements << std::endl;
                     break;
 
                 case EXECUTE_ORDERS:
                     std::cout << "\n===========================================" << std::endl;
                     std::cout << "       " << currentActivePlayer->getName() << " : EXECUTE ORDERS PHASE" << std::endl;
                     std::cout << "===========================================" << std::endl;
-                    std::cout << "Orders left: " << currentActivePlayer->getOrdersList().size() << std::endl;
-                    std::cout << "Number of territories controlled: " << currentActivePlayer->getOwnedTerritories().size() << std::endl;
+                    std::cout << "Orders left: " << event.orders << std::endl;
+                    std::cout << "Number of territories controlled: " << currentActivePlayer->getNumberOfOwnedTerritories() << std::endl;
                     break;
 
                 default:
@@ -199,19 +201,6 @@ void PhaseObserver::display() const
     resetColorCode();
 }
 
-// Check if the state of the subject has changed
-bool PhaseObserver::stateChanged_() const
-{
-    return lastPhase_ != subject_->getPhase() || lastActivePlayer_ != subject_->getActivePlayer();
-}
-
-// Take a snapshot of the subject's state
-void PhaseObserver::saveState_()
-{
-    lastPhase_ = subject_->getPhase();
-    lastActivePlayer_ = subject_->getActivePlayer();
-}
-
 
 /* 
 ==================================================
@@ -220,18 +209,12 @@ void PhaseObserver::saveState_()
  */
 
 // Constructors
-GameStatisticsObserver::GameStatisticsObserver() : Observer() {}
+GameStatisticsObserver::GameStatisticsObserver() : Observer(), displayPending_(true) {}
 
-GameStatisticsObserver::GameStatisticsObserver(Subject* subject) : Observer(subject)
-{
-    for (const auto &player : subject_->getCurrentPlayers())
-    {
-        lastSetOfPlayers_.push_back(*player);
-    }
-}
+GameStatisticsObserver::GameStatisticsObserver(Subject* subject) : Observer(subject), displayPending_(true) {}
 
 GameStatisticsObserver::GameStatisticsObserver(const GameStatisticsObserver &observer)
-    : Observer(observer), lastSetOfPlayers_(observer.lastSetOfPlayers_) {}
+    : Observer(observer), displayPending_(observer.displayPending_) {}
 
 // Assignment operator overloading
 const GameStatisticsObserver &GameStatisticsObserver::operator=(const GameStatisticsObserver &observer)
@@ -239,19 +222,29 @@ const GameStatisticsObserver &GameStatisticsObserver::operator=(const GameStatis
     if (this != &observer)
     {
         Observer::operator=(observer);
-        lastSetOfPlayers_ = observer.lastSetOfPlayers_;
+        displayPending_ = observer.displayPending_;
     }
     return *this;
 }
 
-// Update observer
-void GameStatisticsObserver::update()
+// Display the statistics every time a territory changes hands, once the territories have been dealt, and once players
+// have been eliminated at the end of a round
+void GameStatisticsObserver::subscribe(EventBus &events)
 {
-    if (stateChanged_())
-    {
+    events.subscribe<TerritoryCaptured>(this, [this](const TerritoryCaptured &) {
         display();
-        saveState_();
-    }
+        displayPending_ = false;
+    });
+    events.subscribe<PlayerEliminated>(this, [this](const PlayerEliminated &) {
+        displayPending_ = true;
+    });
+    events.subscribe<PhaseChanged>(this, [this](const PhaseChanged &event) {
+        if (displayPending_ && event.phase != STARTUP)
+        {
+            display();
+            displayPending_ = false;
+        }
+    });
 }
 
 // Output the subject state to console
@@ -262,7 +255,7 @@ void GameStatisticsObserver::display() const
     int totalNumberOfTerritories = 0;
     for (const auto &player : allPlayers)
     {
-        totalNumberOfTerritories += player->getOwnedTerritories().size();
+        totalNumberOfTerritories += player->getNumberOfOwnedTerritories();
     }
 
     setBold();
@@ -276,7 +269,7 @@ void GameStatisticsObserver::display() const
 
     for (const auto &player : allPlayers)
     {
-        int territoriesOwned = player->getOwnedTerritories().size();
+        int territoriesOwned = player->getNumberOfOwnedTerritories();
         double percentControlled = (double)territoriesOwned / totalNumberOfTerritories * 100;
         
         std::cout << std::left << std::setw(20) << std::setfill(' ') << player->getName();
@@ -294,36 +287,6 @@ void GameStatisticsObserver::display() const
     resetColorCode();
 }
 
-// Check if the state of the subject has changed
-bool GameStatisticsObserver::stateChanged_() const
-{
-    std::vector<Player*> allPlayers = subject_->getCurrentPlayers();
-    if (lastSetOfPlayers_.size() == allPlayers.size())
-    {
-        bool changed = false;
-        for (int i = 0; i < lastSetOfPlayers_.size(); i++)
-        {
-            Player oldPlayer = lastSetOfPlayers_.at(i);
-            Player newPlayer = *allPlayers.at(i);
-            changed |= oldPlayer.getOwnedTerritories() != newPlayer.getOwnedTerritories();
-        }
-
-        return changed;
-    }
-
-    return true;
-}
-
-// Take a snapshot of the subject's state
-void GameStatisticsObserver::saveState_()
-{
-    lastSetOfPlayers_.clear();
-    for (auto const &player : subject_->getCurrentPlayers())
-    {
-        lastSetOfPlayers_.push_back(*player);
-    }
-}
-
 /* 
 =========================================
  Implementation for Subject class
@@ -339,26 +302,25 @@ Subject::~Subject()
     observers_.clear();
 }
 
-// Add an observer to the list of observers
+// Events published by the subject, for subscribers other than observers
+EventBus &Subject::getEvents()
+{
+    return events_;
+}
+
+// Add an observer to the list of observers, which the subject then owns
 void Subject::attach(Observer* observer)
 {
     observers_.push_back(observer);
+    observer->subscribe(events_);
 }
 
 // Remove an observer from the list of observers
 void Subject::detach(Observer* observer)
 {
+    events_.unsubscribe(observer);
     auto removeIterator = remove(observers_.begin(), observers_.end(), observer);
     observers_.erase(removeIterator, observers_.end());
     delete observer;
     observer = nullptr;
 }
-
-// Notify all observers to update
-void Subject::notify()
-{
-    for (const auto &observer : observers_)
-    {
-        observer->update();
-    }
-}
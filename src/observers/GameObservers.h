@@ -1,25 +1,18 @@
 #pragma once
 
 #include "../player/Player.h"
+#include "EventBus.h"
 #include <iostream>
 #include <vector>
 
 class Subject;
 
-enum Phase : short
-{
-    STARTUP,
-    REINFORCEMENT,
-    ISSUE_ORDERS,
-    EXECUTE_ORDERS,
-    NONE
-};
-
+// Displays parts of a game on the console. An observer subscribes to the events it needs once attached to a subject.
 class Observer
 {
     public:
         virtual ~Observer();
-        virtual void update() = 0;
+        virtual void subscribe(EventBus &events) = 0;
 
     protected:
         Subject* subject_;
@@ -27,8 +20,6 @@ class Observer
         Observer(Subject* subject);
         Observer(const Observer &observer);
         const Observer &operator=(const Observer &observer);
-        virtual bool stateChanged_() const = 0;
-        virtual void saveState_() = 0;
 };
 
 class PhaseObserver : public Observer
@@ -38,16 +29,12 @@ class PhaseObserver : public Observer
         PhaseObserver(Subject* subject);
         PhaseObserver(const PhaseObserver &observer);
         const PhaseObserver &operator=(const PhaseObserver &observer);
-        void update();
-        void display() const;
-
-    protected:
-        bool stateChanged_() const;
-        void saveState_();
+        void subscribe(EventBus &events);
+        void display(const PhaseChanged &event) const;
 
     private:
         Phase lastPhase_;
-        Player* lastActivePlayer_;
+        PlayerId lastActivePlayerId_;
 };
 
 class GameStatisticsObserver : public Observer
@@ -57,15 +44,11 @@ class GameStatisticsObserver : public Observer
         GameStatisticsObserver(Subject* subject);
         GameStatisticsObserver(const GameStatisticsObserver &observer);
         const GameStatisticsObserver &operator=(const GameStatisticsObserver &observer);
-        void update();
+        void subscribe(EventBus &events);
         void display() const;
 
-    protected:
-        bool stateChanged_() const;
-        void saveState_();
-
     private:
-        std::vector<Player> lastSetOfPlayers_;
+        bool displayPending_;
 };
 
 class Subject
@@ -75,10 +58,29 @@ class Subject
         virtual Phase getPhase() const = 0;
         virtual Player* getActivePlayer() const = 0;
         virtual std::vector<Player*> getCurrentPlayers() const = 0;
+        EventBus &getEvents();
         void attach(Observer* observer);
         void detach(Observer* observer);
-        void notify();
-    
+
+    protected:
+        template <typename Event> void publish(const Event &event) const;
+        template <typename Event> bool hasSubscribers() const;
+
     private:
         std::vector<Observer*> observers_;
+        EventBus events_;
 };
+
+
+// Deliver an event to the observers and other subscribers to its type
+template <typename Event>
+void Subject::publish(const Event &event) const
+{
+    events_.publish(event);
+}
+
+template <typename Event>
+bool Subject::hasSubscribers() const
+{
+    return events_.hasSubscribers<Event>();
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Bounded queue for exactly one producer thread and one consumer thread, without locks. The capacity is rounded up to
+// a power of two. Each side owns one index and only reads the other's, keeping its last reading to avoid touching the
+// other side's cache line until the queue looks full (or empty).
+template <typename T>
+class RingBuffer
+{
+public:
+    RingBuffer(std::size_t capacity);
+    RingBuffer(const RingBuffer &buffer) = delete;
+    const RingBuffer &operator=(const RingBuffer &buffer) = delete;
+    bool tryPush(T &&item);
+    bool tryPop(T &item);
+    std::size_t getCapacity() const;
+    std::size_t getSize() const;
+
+private:
+    std::vector<T> slots_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> head_;
+    std::size_t cachedTail_;
+    alignas(64) std::atomic<std::size_t> tail_;
+    std::size_t cachedHead_;
+};
+
+
+template <typename T>
+RingBuffer<T>::RingBuffer(std::size_t capacity) : head_(0), cachedTail_(0), tail_(0), cachedHead_(0)
+{
+    if (capacity < 1)
+    {
+        throw "A ring buffer needs room for at least one item.";
+    }
+
+    std::size_t roundedCapacity = 1;
+    while (roundedCapacity < capacity)
+    {
+        roundedCapacity *= 2;
+    }
+    slots_.resize(roundedCapacity);
+    mask_ = roundedCapacity - 1;
+}
+
+// Producer side. Move `item` into the queue, or leave it untouched and return `false` if the queue is full.
+template <typename T>
+bool RingBuffer<T>::tryPush(T &&item)
+{
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cachedHead_ == slots_.size())
+    {
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        if (tail - cachedHead_ == slots_.size())
+        {
+            return false;
+        }
+    }
+
+    slots_[tail & mask_] = std::move(item);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// Consumer side. Move the oldest item out of the queue into `item`, or return `false` if the queue is empty.
+template <typename T>
+bool RingBuffer<T>::tryPop(T &item)
+{
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cachedTail_)
+    {
+        cachedTail_ = tail_.load(std::memory_order_acquire);
+        if (head == cachedTail_)
+        {
+            return false;
+        }
+    }
+
+    item = std::move(slots_[head & mask_]);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+std::size_t RingBuffer<T>::getCapacity() const
+{
+    return slots_.size();
+}
+
+// Producer side. Number of items in the queue, which the consumer may have taken some of by the time it returns.
+template <typename T>
+std::size_t RingBuffer<T>::getSize() const
+{
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+}
@@ -1,11 +1,39 @@
 #include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../profiling/AllocationTracker.h"
+#include "../profiling/Profiler.h"
+#include "../profiling/Tracer.h"
+#include "../recorder/GameRecorder.h"
 #include "Orders.h"
 #include <algorithm>
 #include <iterator>
 #include <math.h>
+#include <utility>
 
 namespace
 {
+    // Span names of the order types when tracing
+    const char* const ORDER_TYPE_NAMES[] = { "DeployOrder", "AdvanceOrder", "BombOrder", "BlockadeOrder", "AirliftOrder", "NegotiateOrder" };
+
+    // Handles of the players and territories orders refer to, which may be missing
+    PlayerId getIdOf(Player* player)
+    {
+        return player == nullptr ? NO_PLAYER_ID : player->getId();
+    }
+
+    TerritoryId getIdOf(Territory* territory)
+    {
+        return territory == nullptr ? NO_TERRITORY_ID : territory->getId();
+    }
+
+    // Territories an order refers to, leaving out the ones it does not have (e.g. orders of cards played without a target)
+    std::vector<Territory*> getTerritoriesPresent(std::initializer_list<Territory*> territories)
+    {
+        std::vector<Territory*> territoriesPresent;
+        std::copy_if(territories.begin(), territories.end(), std::back_inserter(territoriesPresent), [](auto t) { return t != nullptr; });
+        return territoriesPresent;
+    }
+
     // Custom comparator to sort Orders by priority
     bool compareOrders(Order* order1, Order* order2)
     {
@@ -19,12 +47,11 @@ namespace
     bool canAttack(Player* attacker, Territory* target)
     {
         Player* ownerOfTarget = GameEngine::getOwnerOf(target);
-        std::vector<Player*> diplomaticRelations = attacker->getDiplomaticRelations();
-        bool diplomacyWithOwnerOfTarget = find(diplomaticRelations.begin(), diplomaticRelations.end(), ownerOfTarget) != diplomaticRelations.end();
+        bool diplomacyWithOwnerOfTarget = attacker->hasDiplomaticRelation(ownerOfTarget);
 
         if (diplomacyWithOwnerOfTarget)
         {
-            std::cout << attacker->getName() << " and " << ownerOfTarget->getName() << " cannot attack each other for the rest of this turn. ";
+            LOG_INFO(attacker->getName() << " and " << ownerOfTarget->getName() << " cannot attack each other for the rest of this turn. ");
         }
 
         return attacker == ownerOfTarget || !diplomacyWithOwnerOfTarget;
@@ -39,11 +66,11 @@ namespace
  */
 
 // Constructors
-Order::Order(): issuer_(nullptr), priority_(4) {}
+Order::Order(): issuerId_(NO_PLAYER_ID), priority_(4) {}
 
-Order::Order(Player* issuer, int priority) : issuer_(issuer), priority_(priority) {}
+Order::Order(Player* issuer, int priority) : issuerId_(getIdOf(issuer)), priority_(priority) {}
 
-Order::Order(const Order &order) : issuer_(order.issuer_), priority_(order.priority_) {}
+Order::Order(const Order &order) : issuerId_(order.issuerId_), priority_(order.priority_) {}
 
 // Destructor
 Order::~Order() {}
@@ -53,7 +80,7 @@ const Order &Order::operator=(const Order &order)
 {
     if (this != &order)
     {
-        issuer_ = order.issuer_;
+        issuerId_ = order.issuerId_;
         priority_ = order.priority_;
     }
     return *this;
@@ -67,15 +94,33 @@ std::ostream &operator<<(std::ostream &output, const Order &order)
 // Validate and execute the Order. Invalid orders will have no effect.
 void Order::execute()
 {
-    if (validate())
+    PROFILE_SCOPE(ORDER_EXECUTION_SECTION);
+    PROFILE_COUNT_ORDER(ORDERS_EXECUTED_COUNTER, this);
+    TRACE_SCOPE(ORDER_TYPE_NAMES[getType()], "order");
+    ALLOCATION_SCOPE(ORDERS_TAG);
+
+    GameRecorder* recorder = GameEngine::getRecorder();
+    if (recorder != nullptr)
+    {
+        recorder->beginOrderExecution(this);
+    }
+
+    bool valid = validate();
+    if (valid)
     {
         execute_();
     }
     else
     {
-        std::cout << "Order invalidated. Skipping..." << std::endl;
+        LOG_INFO("Order invalidated. Skipping...\n");
+        PROFILE_COUNT_ORDER(ORDERS_INVALIDATED_COUNTER, this);
         undo_();
     }
+
+    if (recorder != nullptr)
+    {
+        recorder->recordOrderExecuted(this, valid);
+    }
 }
 
 // Get order priority
@@ -84,6 +129,18 @@ int Order::getPriority() const
     return priority_;
 }
 
+// Get the player who issued the order
+Player* Order::getIssuer() const
+{
+    return GameEngine::getPlayer(issuerId_);
+}
+
+// Get the territories whose owner or number of armies executing the order can change
+std::vector<Territory*> Order::getAffectedTerritories() const
+{
+    return {};
+}
+
 // Reverse the pre-orders-execution game state back to before the order was created.
 // The default behavior is to do nothing if there is no meta-state to reset
 // (e.g. resetting pending incoming/outgoing armies from territories)
@@ -107,6 +164,12 @@ OrdersList::OrdersList(const OrdersList &orders)
     }
 }
 
+// A moved list takes over the orders of `orders`, which is left empty
+OrdersList::OrdersList(OrdersList &&orders) noexcept : orders_(std::move(orders.orders_))
+{
+    orders.orders_.clear();
+}
+
 // Destructor
 OrdersList::~OrdersList()
 {
@@ -127,6 +190,20 @@ const OrdersList &OrdersList::operator=(const OrdersList &orders)
     return *this;
 }
 
+const OrdersList &OrdersList::operator=(OrdersList &&orders) noexcept
+{
+    if (this != &orders)
+    {
+        for (const auto &order : orders_)
+        {
+            delete order;
+        }
+        orders_ = std::move(orders.orders_);
+        orders.orders_.clear();
+    }
+    return *this;
+}
+
 std::ostream &operator<<(std::ostream &output, const OrdersList &orders)
 {
     output << "[Orders List] Size=" << orders.size();
@@ -162,6 +239,16 @@ Order* OrdersList::popTopOrder()
     return topOrder;
 }
 
+// Pop every order in the OrderList, sorted by priority. Orders of the same priority stay in the order they were added.
+std::vector<Order*> OrdersList::popAllOrders()
+{
+    std::vector<Order*> orders;
+    orders.swap(orders_);
+    stable_sort(orders.begin(), orders.end(), compareOrders);
+
+    return orders;
+}
+
 // Get the first order in the OrderList according to priority without removing it
 Order* OrdersList::peek()
 {
@@ -190,8 +277,8 @@ void OrdersList::add(Order* order)
 // Move an order within the OrderList from `source` position to `destination` position.
 void OrdersList::move(int source, int destination)
 {
-    bool sourceInRange = source >= 0 && source < orders_.size();
-    bool destinationInRange = destination >= 0 && destination < orders_.size();
+    bool sourceInRange = source >= 0 && source < static_cast<int>(orders_.size());
+    bool destinationInRange = destination >= 0 && destination < static_cast<int>(orders_.size());
 
     if (sourceInRange && destinationInRange)
     {
@@ -236,11 +323,11 @@ void OrdersList::remove(int target)
  */
 
 // Constructors
-DeployOrder::DeployOrder() : Order(nullptr, 1), numberOfArmies_(0), destination_(nullptr) {}
+DeployOrder::DeployOrder() : Order(nullptr, 1), numberOfArmies_(0), destinationId_(NO_TERRITORY_ID) {}
 
-DeployOrder::DeployOrder(Player* issuer, int numberOfArmies, Territory* destination) : Order(issuer, 1), numberOfArmies_(numberOfArmies), destination_(destination) {}
+DeployOrder::DeployOrder(Player* issuer, int numberOfArmies, Territory* destination) : Order(issuer, 1), numberOfArmies_(numberOfArmies), destinationId_(getIdOf(destination)) {}
 
-DeployOrder::DeployOrder(const DeployOrder &order) : Order(order), numberOfArmies_(order.numberOfArmies_), destination_(order.destination_) {}
+DeployOrder::DeployOrder(const DeployOrder &order) : Order(order), numberOfArmies_(order.numberOfArmies_), destinationId_(order.destinationId_) {}
 
 // Operator overloading
 const DeployOrder &DeployOrder::operator=(const DeployOrder &order)
@@ -249,18 +336,19 @@ const DeployOrder &DeployOrder::operator=(const DeployOrder &order)
     {
         Order::operator=(order);
         numberOfArmies_ = order.numberOfArmies_;
-        destination_ = order.destination_;
+        destinationId_ = order.destinationId_;
     }
     return *this;
 }
 
 std::ostream &DeployOrder::print_(std::ostream &output) const
 {
+    Territory* destination = getDestination();
     output << "[DeployOrder]";
 
-    if (destination_ != nullptr)
+    if (destination != nullptr)
     {
-        output << " " << numberOfArmies_ << " armies to " << destination_->getName();
+        output << " " << numberOfArmies_ << " armies to " << destination->getName();
     }
 
     return output;
@@ -278,32 +366,51 @@ void DeployOrder::addArmies(int additional)
     numberOfArmies_ += additional;
 }
 
+// Getters
+int DeployOrder::getNumberOfArmies() const
+{
+    return numberOfArmies_;
+}
+
+Territory* DeployOrder::getDestination() const
+{
+    return GameEngine::getTerritory(destinationId_);
+}
+
+std::vector<Territory*> DeployOrder::getAffectedTerritories() const
+{
+    return getTerritoriesPresent({ getDestination() });
+}
+
 // Checks that the DeployOrder is valid.
 bool DeployOrder::validate() const
-{   
-    if (issuer_ == nullptr || destination_ == nullptr)
+{
+    Player* issuer = getIssuer();
+    Territory* destination = getDestination();
+    if (issuer == nullptr || destination == nullptr)
     {
         return false;
     }
 
-    std::vector<Territory*> currentPlayerTerritories = issuer_->getOwnedTerritories();
-    return find(currentPlayerTerritories.begin(), currentPlayerTerritories.end(), destination_) != currentPlayerTerritories.end();
+    return GameEngine::getOwnerOf(destination) == issuer;
 }
 
 // Executes the DeployOrder.
 void DeployOrder::execute_()
 {
-    destination_->addArmies(numberOfArmies_);
-    destination_->setPendingIncomingArmies(0);
-    std::cout << "Deployed " << numberOfArmies_ << " armies to " << destination_->getName() << "." << std::endl;
+    Territory* destination = getDestination();
+    destination->addArmies(numberOfArmies_);
+    destination->setPendingIncomingArmies(0);
+    LOG_INFO("Deployed " << numberOfArmies_ << " armies to " << destination->getName() << ".\n");
 }
 
 // Reverse the pre-orders-execution game state back to before the order was created.
 // Resets the contribution of this order to the number of pending incoming armies on the destination territory.
 void DeployOrder::undo_()
 {
-    int newPendingIncomingArmies = destination_->getPendingIncomingArmies() - numberOfArmies_;
-    destination_->setPendingIncomingArmies(newPendingIncomingArmies);
+    Territory* destination = getDestination();
+    int newPendingIncomingArmies = destination->getPendingIncomingArmies() - numberOfArmies_;
+    destination->setPendingIncomingArmies(newPendingIncomingArmies);
 }
 
 // Get the type of the Order sub-class
@@ -320,13 +427,13 @@ OrderType DeployOrder::getType() const
  */
 
 // Constructors
-AdvanceOrder::AdvanceOrder() : Order(), numberOfArmies_(0), source_(nullptr), destination_(nullptr) {}
+AdvanceOrder::AdvanceOrder() : Order(), numberOfArmies_(0), sourceId_(NO_TERRITORY_ID), destinationId_(NO_TERRITORY_ID) {}
 
 AdvanceOrder::AdvanceOrder(Player* issuer, int numberOfArmies, Territory* source, Territory* destination)
-    : Order(issuer, 4), numberOfArmies_(numberOfArmies), source_(source), destination_(destination) {}
+    : Order(issuer, 4), numberOfArmies_(numberOfArmies), sourceId_(getIdOf(source)), destinationId_(getIdOf(destination)) {}
 
 AdvanceOrder::AdvanceOrder(const AdvanceOrder &order)
-    : Order(order), numberOfArmies_(order.numberOfArmies_), source_(order.source_), destination_(order.destination_) {}
+    : Order(order), numberOfArmies_(order.numberOfArmies_), sourceId_(order.sourceId_), destinationId_(order.destinationId_) {}
 
 // Operator overloading
 const AdvanceOrder &AdvanceOrder::operator=(const AdvanceOrder &order)
@@ -335,19 +442,21 @@ const AdvanceOrder &AdvanceOrder::operator=(const AdvanceOrder &order)
     {
         Order::operator=(order);
         numberOfArmies_ = order.numberOfArmies_;
-        source_ = order.source_;
-        destination_ = order.destination_;
+        sourceId_ = order.sourceId_;
+        destinationId_ = order.destinationId_;
     }
     return *this;
 }
 
 std::ostream &AdvanceOrder::print_(std::ostream &output) const
 {
+    Territory* source = getSource();
+    Territory* destination = getDestination();
     output << "[AdvanceOrder]";
 
-    if (source_ != nullptr && destination_ != nullptr)
+    if (source != nullptr && destination != nullptr)
     {
-        output << " " << numberOfArmies_ << " armies from " << source_->getName() << " to " << destination_->getName();
+        output << " " << numberOfArmies_ << " armies from " << source->getName() << " to " << destination->getName();
     }
 
     return output;
@@ -359,82 +468,109 @@ Order* AdvanceOrder::clone() const
     return new AdvanceOrder(*this);
 }
 
+// Getters
+int AdvanceOrder::getNumberOfArmies() const
+{
+    return numberOfArmies_;
+}
+
+Territory* AdvanceOrder::getSource() const
+{
+    return GameEngine::getTerritory(sourceId_);
+}
+
+Territory* AdvanceOrder::getDestination() const
+{
+    return GameEngine::getTerritory(destinationId_);
+}
+
+std::vector<Territory*> AdvanceOrder::getAffectedTerritories() const
+{
+    return getTerritoriesPresent({ getSource(), getDestination() });
+}
+
 // Checks that the AdvanceOrder is valid.
 bool AdvanceOrder::validate() const
 {
-    if (issuer_ == nullptr || source_ == nullptr || destination_ == nullptr)
+    Player* issuer = getIssuer();
+    Territory* source = getSource();
+    Territory* destination = getDestination();
+    if (issuer == nullptr || source == nullptr || destination == nullptr)
     {
         return false;
     }
 
-    std::vector<Territory*> currentPlayerTerritories = issuer_->getOwnedTerritories();
-    bool validSourceTerritory = find(currentPlayerTerritories.begin(), currentPlayerTerritories.end(), source_) != currentPlayerTerritories.end();
-    bool hasAnyArmiesToAdvance = source_->getNumberOfArmies() > 0;
+    bool validSourceTerritory = GameEngine::getOwnerOf(source) == issuer;
+    bool hasAnyArmiesToAdvance = source->getNumberOfArmies() > 0;
 
-    return validSourceTerritory && hasAnyArmiesToAdvance && canAttack(issuer_, destination_);
+    return validSourceTerritory && hasAnyArmiesToAdvance && canAttack(issuer, destination);
 }
 
 // Executes the AdvanceOrder.
 void AdvanceOrder::execute_()
 {
-    Player* defender = GameEngine::getOwnerOf(destination_);
-    bool offensive = issuer_ != defender;
+    Player* issuer = getIssuer();
+    Territory* source = getSource();
+    Territory* destination = getDestination();
+    Player* defender = GameEngine::getOwnerOf(destination);
+    bool offensive = issuer != defender;
 
     // Recalculate how many armies could actually be moved (in case the state of the territory has changed due to an attack)
-    int movableArmiesFromSource = std::min(source_->getNumberOfArmies(), numberOfArmies_); 
+    int movableArmiesFromSource = std::min(source->getNumberOfArmies(), numberOfArmies_); 
 
     if (offensive)
     {
         // Simulate battle
-        source_->removeArmies(movableArmiesFromSource);
+        source->removeArmies(movableArmiesFromSource);
 
         int defendersKilled = round(movableArmiesFromSource * 0.6);
-        int attackersKilled = round(destination_->getNumberOfArmies() * 0.7);
+        int attackersKilled = round(destination->getNumberOfArmies() * 0.7);
 
         int survivingAttackers = std::max(movableArmiesFromSource - attackersKilled, 0);
-        int survivingDefenders = std::max(destination_->getNumberOfArmies() - defendersKilled, 0);
-        destination_->removeArmies(defendersKilled);
+        int survivingDefenders = std::max(destination->getNumberOfArmies() - defendersKilled, 0);
+        destination->removeArmies(defendersKilled);
 
         // Failed attack
         if (survivingDefenders > 0 || survivingAttackers <= 0)
         {
-            source_->addArmies(survivingAttackers);
-            std::cout << "Failed attack on " << destination_->getName() << " with " << survivingDefenders << " enemy armies left standing.";
+            source->addArmies(survivingAttackers);
+            LOG_INFO("Failed attack on " << destination->getName() << " with " << survivingDefenders << " enemy armies left standing.");
 
             if (survivingAttackers > 0)
             {
-                std::cout << " Retreating " << survivingAttackers << " attacking armies back to " << source_->getName() << std::endl;
+                LOG_INFO(" Retreating " << survivingAttackers << " attacking armies back to " << source->getName() << "\n");
             }
             else
             {
-                std::cout << std::endl;
+                LOG_INFO("\n");
             }
         }
         // Successful attack
         else
         {
-            issuer_->addOwnedTerritory(destination_);
-            defender->removeOwnedTerritory(destination_);
-            destination_->addArmies(survivingAttackers);
-            std::cout << "Successful attack on " << destination_->getName() << ". " << survivingAttackers << " armies now occupy this territory." << std::endl;
+            issuer->addOwnedTerritory(destination);
+            defender->removeOwnedTerritory(destination);
+            destination->addArmies(survivingAttackers);
+            LOG_INFO("Successful attack on " << destination->getName() << ". " << survivingAttackers << " armies now occupy this territory.\n");
         }
     }
     else
     {
-        source_->removeArmies(movableArmiesFromSource);
-        destination_->addArmies(movableArmiesFromSource);
-        std::cout << "Advanced " << movableArmiesFromSource << " armies from " << source_->getName() << " to " << destination_->getName() << "." << std::endl;
+        source->removeArmies(movableArmiesFromSource);
+        destination->addArmies(movableArmiesFromSource);
+        LOG_INFO("Advanced " << movableArmiesFromSource << " armies from " << source->getName() << " to " << destination->getName() << ".\n");
     }
 
-    source_->setPendingOutgoingArmies(0);
+    source->setPendingOutgoingArmies(0);
 }
 
 // Reverse the pre-orders-execution game state back to before the order was created.
 // Resets the contribution of this order to the number of pending outgoing armies from the source territory.
 void AdvanceOrder::undo_()
 {
-    int newPendingOutgoingArmies = source_->getPendingOutgoingArmies() - numberOfArmies_;
-    source_->setPendingOutgoingArmies(newPendingOutgoingArmies);
+    Territory* source = getSource();
+    int newPendingOutgoingArmies = source->getPendingOutgoingArmies() - numberOfArmies_;
+    source->setPendingOutgoingArmies(newPendingOutgoingArmies);
 }
 
 // Get the type of the Order sub-class
@@ -451,11 +587,11 @@ OrderType AdvanceOrder::getType() const
  */
 
 // Constructors
-BombOrder::BombOrder() : Order(), target_(nullptr) {}
+BombOrder::BombOrder() : Order(), targetId_(NO_TERRITORY_ID) {}
 
-BombOrder::BombOrder(Player* issuer, Territory* target) : Order(issuer, 4), target_(target) {}
+BombOrder::BombOrder(Player* issuer, Territory* target) : Order(issuer, 4), targetId_(getIdOf(target)) {}
 
-BombOrder::BombOrder(const BombOrder &order) : Order(order), target_(order.target_) {}
+BombOrder::BombOrder(const BombOrder &order) : Order(order), targetId_(order.targetId_) {}
 
 // Operator overloading
 const BombOrder &BombOrder::operator=(const BombOrder &order)
@@ -463,18 +599,19 @@ const BombOrder &BombOrder::operator=(const BombOrder &order)
     if (this != &order)
     {
         Order::operator=(order);
-        target_ = order.target_;
+        targetId_ = order.targetId_;
     }
     return *this;
 }
 
 std::ostream &BombOrder::print_(std::ostream &output) const
 {
+    Territory* target = getTarget();
     output << "[BombOrder]";
 
-    if (target_ != nullptr)
+    if (target != nullptr)
     {
-        output << " Target: " << target_->getName();
+        output << " Target: " << target->getName();
     }
 
     return output;
@@ -486,26 +623,38 @@ Order* BombOrder::clone() const
     return new BombOrder(*this);
 }
 
+// Getters
+Territory* BombOrder::getTarget() const
+{
+    return GameEngine::getTerritory(targetId_);
+}
+
+std::vector<Territory*> BombOrder::getAffectedTerritories() const
+{
+    return getTerritoriesPresent({ getTarget() });
+}
+
 // Checks that the BombOrder is valid.
 bool BombOrder::validate() const
 {
-    if (issuer_ == nullptr || target_ == nullptr)
+    Player* issuer = getIssuer();
+    Territory* target = getTarget();
+    if (issuer == nullptr || target == nullptr)
     {
         return false;
     }
 
-    std::vector<Territory*> currentPlayerTerritories = issuer_->getOwnedTerritories();
-    bool validTargetTerritory = find(currentPlayerTerritories.begin(), currentPlayerTerritories.end(), target_) == currentPlayerTerritories.end();
-    return validTargetTerritory && canAttack(issuer_, target_);
+    bool validTargetTerritory = GameEngine::getOwnerOf(target) != issuer;
+    return validTargetTerritory && canAttack(issuer, target);
 }
 
 // Executes the BombOrder.
 void BombOrder::execute_()
 {
-    int armiesOnTarget = target_->getNumberOfArmies();
-    target_->removeArmies(armiesOnTarget / 2);
-    std::cout << "Bombed " << armiesOnTarget / 2 << " enemy armies on " << target_->getName() << ". ";
-    std::cout << target_->getNumberOfArmies() << " remaining." << std::endl;
+    Territory* target = getTarget();
+    int armiesOnTarget = target->getNumberOfArmies();
+    target->removeArmies(armiesOnTarget / 2);
+    LOG_INFO("Bombed " << armiesOnTarget / 2 << " enemy armies on " << target->getName() << ". " << target->getNumberOfArmies() << " remaining.\n");
 }
 
 // Get the type of the Order sub-class
@@ -522,11 +671,11 @@ OrderType BombOrder::getType() const
  */
 
 // Constructors
-BlockadeOrder::BlockadeOrder() : Order(nullptr, 3), territory_(nullptr) {}
+BlockadeOrder::BlockadeOrder() : Order(nullptr, 3), territoryId_(NO_TERRITORY_ID) {}
 
-BlockadeOrder::BlockadeOrder(Player* issuer, Territory* territory) : Order(issuer, 3), territory_(territory) {}
+BlockadeOrder::BlockadeOrder(Player* issuer, Territory* territory) : Order(issuer, 3), territoryId_(getIdOf(territory)) {}
 
-BlockadeOrder::BlockadeOrder(const BlockadeOrder &order) : Order(order), territory_(order.territory_) {}
+BlockadeOrder::BlockadeOrder(const BlockadeOrder &order) : Order(order), territoryId_(order.territoryId_) {}
 
 // Operator overloading
 const BlockadeOrder &BlockadeOrder::operator=(const BlockadeOrder &order)
@@ -534,18 +683,19 @@ const BlockadeOrder &BlockadeOrder::operator=(const BlockadeOrder &order)
     if (this != &order)
     {
         Order::operator=(order);
-        territory_ = order.territory_;
+        territoryId_ = order.territoryId_;
     }
     return *this;
 }
 
 std::ostream &BlockadeOrder::print_(std::ostream &output) const
 {
+    Territory* territory = getTerritory();
     output << "[BlockadeOrder]";
 
-    if (territory_ != nullptr)
+    if (territory != nullptr)
     {
-        output << " Territory: " << territory_->getName() << " (" << territory_->getNumberOfArmies() << " present)";
+        output << " Territory: " << territory->getName() << " (" << territory->getNumberOfArmies() << " present)";
     }
 
     return output;
@@ -557,25 +707,37 @@ Order* BlockadeOrder::clone() const
     return new BlockadeOrder(*this);
 }
 
+// Getters
+Territory* BlockadeOrder::getTerritory() const
+{
+    return GameEngine::getTerritory(territoryId_);
+}
+
+std::vector<Territory*> BlockadeOrder::getAffectedTerritories() const
+{
+    return getTerritoriesPresent({ getTerritory() });
+}
+
 // Checks that the BlockadeOrder is valid.
 bool BlockadeOrder::validate() const
 {
-    if (issuer_ == nullptr || territory_ == nullptr)
+    Player* issuer = getIssuer();
+    Territory* territory = getTerritory();
+    if (issuer == nullptr || territory == nullptr)
     {
         return false;
     }
 
-    std::vector<Territory*> currentPlayerTerritories = issuer_->getOwnedTerritories();
-    return find(currentPlayerTerritories.begin(), currentPlayerTerritories.end(), territory_) != currentPlayerTerritories.end();
+    return GameEngine::getOwnerOf(territory) == issuer;
 }
 
 // Executes the BlockadeOrder.
 void BlockadeOrder::execute_()
 {
-    territory_->addArmies(territory_->getNumberOfArmies());
-    GameEngine::assignToNeutralPlayer(territory_);
-    std::cout << "Blockade called on " << territory_->getName() << ". ";
-    std::cout << territory_->getNumberOfArmies() << " neutral armies now occupy this territory." << std::endl;
+    Territory* territory = getTerritory();
+    territory->addArmies(territory->getNumberOfArmies());
+    GameEngine::assignToNeutralPlayer(territory);
+    LOG_INFO("Blockade called on " << territory->getName() << ". " << territory->getNumberOfArmies() << " neutral armies now occupy this territory.\n");
 }
 
 // Get the type of the Order sub-class
@@ -592,12 +754,12 @@ OrderType BlockadeOrder::getType() const
  */
 
 // Constructors
-AirliftOrder::AirliftOrder() : Order(nullptr, 2), numberOfArmies_(0), source_(nullptr), destination_(nullptr) {}
+AirliftOrder::AirliftOrder() : Order(nullptr, 2), numberOfArmies_(0), sourceId_(NO_TERRITORY_ID), destinationId_(NO_TERRITORY_ID) {}
 
 AirliftOrder::AirliftOrder(Player* issuer, int numberOfArmies, Territory* source, Territory* destination)
-    : Order(issuer, 2), numberOfArmies_(numberOfArmies), source_(source), destination_(destination) {}
+    : Order(issuer, 2), numberOfArmies_(numberOfArmies), sourceId_(getIdOf(source)), destinationId_(getIdOf(destination)) {}
 
-AirliftOrder::AirliftOrder(const AirliftOrder &order) : Order(order), numberOfArmies_(order.numberOfArmies_), source_(order.source_), destination_(order.destination_) {}
+AirliftOrder::AirliftOrder(const AirliftOrder &order) : Order(order), numberOfArmies_(order.numberOfArmies_), sourceId_(order.sourceId_), destinationId_(order.destinationId_) {}
 
 // Operator overloading
 const AirliftOrder &AirliftOrder::operator=(const AirliftOrder &order)
@@ -606,19 +768,21 @@ const AirliftOrder &AirliftOrder::operator=(const AirliftOrder &order)
     {
         Order::operator=(order);
         numberOfArmies_ = order.numberOfArmies_;
-        source_ = order.source_;
-        destination_ = order.destination_;
+        sourceId_ = order.sourceId_;
+        destinationId_ = order.destinationId_;
     }
     return *this;
 }
 
 std::ostream &AirliftOrder::print_(std::ostream &output) const
 {
+    Territory* source = getSource();
+    Territory* destination = getDestination();
     output << "[AirliftOrder]";
 
-    if (source_ != nullptr && destination_ != nullptr)
+    if (source != nullptr && destination != nullptr)
     {
-        output << " " << numberOfArmies_ << " armies from " << source_->getName() << " to " << destination_->getName();
+        output << " " << numberOfArmies_ << " armies from " << source->getName() << " to " << destination->getName();
     }
 
     return output;
@@ -630,19 +794,41 @@ Order* AirliftOrder::clone() const
     return new AirliftOrder(*this);
 }
 
+// Getters
+int AirliftOrder::getNumberOfArmies() const
+{
+    return numberOfArmies_;
+}
+
+Territory* AirliftOrder::getSource() const
+{
+    return GameEngine::getTerritory(sourceId_);
+}
+
+Territory* AirliftOrder::getDestination() const
+{
+    return GameEngine::getTerritory(destinationId_);
+}
+
+std::vector<Territory*> AirliftOrder::getAffectedTerritories() const
+{
+    return getTerritoriesPresent({ getSource(), getDestination() });
+}
+
 // Checks that the AirliftOrder is valid.
 bool AirliftOrder::validate() const
 {
-    if (issuer_ == nullptr || source_ == nullptr || destination_ == nullptr || source_ == destination_)
+    Player* issuer = getIssuer();
+    Territory* source = getSource();
+    Territory* destination = getDestination();
+    if (issuer == nullptr || source == nullptr || destination == nullptr || source == destination)
     {
         return false;
     }
 
-    std::vector<Territory*> currentPlayerTerritories = issuer_->getOwnedTerritories();
-
-    bool validSourceTerritory = find(currentPlayerTerritories.begin(), currentPlayerTerritories.end(), source_) != currentPlayerTerritories.end();
-    bool validDestinationTerritory = find(currentPlayerTerritories.begin(), currentPlayerTerritories.end(), destination_) != currentPlayerTerritories.end();
-    bool hasAnyArmiesToAirlift = source_->getNumberOfMovableArmies() > 0;
+    bool validSourceTerritory = GameEngine::getOwnerOf(source) == issuer;
+    bool validDestinationTerritory = GameEngine::getOwnerOf(destination) == issuer;
+    bool hasAnyArmiesToAirlift = source->getNumberOfMovableArmies() > 0;
 
     return validSourceTerritory && validDestinationTerritory && hasAnyArmiesToAirlift;
 }
@@ -650,22 +836,32 @@ bool AirliftOrder::validate() const
 // Executes the AirliftOrder.
 void AirliftOrder::execute_()
 {
+    Territory* source = getSource();
+    Territory* destination = getDestination();
+
     // Recalculate how many armies could actually be moved in case the state of the territory has changed due to an attack
-    int movableArmiesFromSource = std::min(source_->getNumberOfArmies(), numberOfArmies_); 
+    int movableArmiesFromSource = std::min(source->getNumberOfArmies(), numberOfArmies_); 
 
-    destination_->addArmies(movableArmiesFromSource);
-    source_->removeArmies(movableArmiesFromSource);
-    source_->setPendingOutgoingArmies(0);
+    destination->addArmies(movableArmiesFromSource);
+    source->removeArmies(movableArmiesFromSource);
+    source->setPendingOutgoingArmies(0);
 
-    std::cout << "Airlifted " << movableArmiesFromSource << " armies from " << source_->getName() << " to " << destination_->getName() << "." << std::endl;
+    LOG_INFO("Airlifted " << movableArmiesFromSource << " armies from " << source->getName() << " to " << destination->getName() << ".\n");
 }
 
 // Reverse the pre-orders-execution game state back to before the order was created.
 // Resets the contribution of this order to the number of pending outgoing armies from the source territory.
 void AirliftOrder::undo_()
 {
-    int newPendingOutgoingArmies = source_->getPendingOutgoingArmies() - numberOfArmies_;
-    source_->setPendingOutgoingArmies(newPendingOutgoingArmies);
+    // Airlift cards played with a single territory owned make orders without a source
+    Territory* source = getSource();
+    if (source == nullptr)
+    {
+        return;
+    }
+
+    int newPendingOutgoingArmies = source->getPendingOutgoingArmies() - numberOfArmies_;
+    source->setPendingOutgoingArmies(newPendingOutgoingArmies);
 }
 
 // Get the type of the Order sub-class
@@ -682,11 +878,11 @@ OrderType AirliftOrder::getType() const
  */
 
 // Constructors
-NegotiateOrder::NegotiateOrder() : Order(), target_(nullptr) {}
+NegotiateOrder::NegotiateOrder() : Order(), targetId_(NO_PLAYER_ID) {}
 
-NegotiateOrder::NegotiateOrder(Player* issuer, Player* target) : Order(issuer, 4), target_(target) {}
+NegotiateOrder::NegotiateOrder(Player* issuer, Player* target) : Order(issuer, 4), targetId_(getIdOf(target)) {}
 
-NegotiateOrder::NegotiateOrder(const NegotiateOrder &order) : Order(order), target_(order.target_) {}
+NegotiateOrder::NegotiateOrder(const NegotiateOrder &order) : Order(order), targetId_(order.targetId_) {}
 
 // Operator overloading
 const NegotiateOrder &NegotiateOrder::operator=(const NegotiateOrder &order)
@@ -694,18 +890,20 @@ const NegotiateOrder &NegotiateOrder::operator=(const NegotiateOrder &order)
     if (this != &order)
     {
         Order::operator=(order);
-        target_ = order.target_;
+        targetId_ = order.targetId_;
     }
     return *this;
 }
 
 std::ostream &NegotiateOrder::print_(std::ostream &output) const
 {
+    Player* issuer = getIssuer();
+    Player* target = getTarget();
     output << "[NegotiateOrder]";
 
-    if (issuer_ != nullptr && target_ != nullptr)
+    if (issuer != nullptr && target != nullptr)
     {
-        output << " Initiator: " << issuer_->getName() << ", Target: " << target_->getName();
+        output << " Initiator: " << issuer->getName() << ", Target: " << target->getName();
     }
 
     return output;
@@ -717,23 +915,34 @@ Order* NegotiateOrder::clone() const
     return new NegotiateOrder(*this);
 }
 
+// Getters
+Player* NegotiateOrder::getTarget() const
+{
+    return GameEngine::getPlayer(targetId_);
+}
+
 // Checks that the NegotiateOrder is valid.
 bool NegotiateOrder::validate() const
 {
-    if (issuer_ == nullptr || target_ == nullptr)
+    Player* issuer = getIssuer();
+    Player* target = getTarget();
+    if (issuer == nullptr || target == nullptr)
     {
         return false;
     }
 
-    return issuer_ != target_;
+    return issuer != target;
 }
 
-// Executes the NegotiateOrder.
+// Executes the NegotiateOrder. This updates the diplomatic relations of the target as well as those of the issuer, so
+// ExecutionSchedule::getBatches() must treat both players as written to.
 void NegotiateOrder::execute_()
 {
-    issuer_->addDiplomaticRelation(target_);
-    target_->addDiplomaticRelation(issuer_);
-    std::cout << "Negotiated diplomacy between " << issuer_->getName() << " and " << target_->getName() << "." << std::endl;
+    Player* issuer = getIssuer();
+    Player* target = getTarget();
+    issuer->addDiplomaticRelation(target);
+    target->addDiplomaticRelation(issuer);
+    LOG_INFO("Negotiated diplomacy between " << issuer->getName() << " and " << target->getName() << ".\n");
 }
 
 // Get the type of the Order sub-class
@@ -26,12 +26,14 @@ public:
     friend std::ostream &operator<<(std::ostream &output, const Order &order);
     void execute();
     int getPriority() const;
+    Player* getIssuer() const;
+    virtual std::vector<Territory*> getAffectedTerritories() const;
     virtual Order* clone() const = 0;
     virtual bool validate() const = 0;
     virtual OrderType getType() const = 0;
 
 protected:
-    Player* issuer_;
+    PlayerId issuerId_;
     Order();
     Order(Player* issuer, int priority);
     Order(const Order &order);
@@ -50,12 +52,15 @@ class OrdersList
 public:
     OrdersList();
     OrdersList(const OrdersList &orders);
+    OrdersList(OrdersList &&orders) noexcept;
     ~OrdersList();
     const OrdersList &operator=(const OrdersList &orders);
+    const OrdersList &operator=(OrdersList &&orders) noexcept;
     friend std::ostream &operator<<(std::ostream &output, const OrdersList &orders);
     std::vector<Order*> getOrders() const;
     void setOrders(std::vector<Order*> orders);
     Order* popTopOrder();
+    std::vector<Order*> popAllOrders();
     Order* peek();
     int size() const;
     void add(Order* order);
@@ -76,7 +81,10 @@ public:
     const DeployOrder &operator=(const DeployOrder &order);
     Order* clone() const;
     void addArmies(int additional);
+    int getNumberOfArmies() const;
+    Territory* getDestination() const;
     bool validate() const;
+    std::vector<Territory*> getAffectedTerritories() const;
     OrderType getType() const;
 
 protected:
@@ -86,7 +94,7 @@ protected:
 
 private:
     int numberOfArmies_;
-    Territory* destination_;
+    TerritoryId destinationId_;
 };
 
 
@@ -98,7 +106,11 @@ public:
     AdvanceOrder(const AdvanceOrder &order);
     const AdvanceOrder &operator=(const AdvanceOrder &order);
     Order* clone() const;
+    int getNumberOfArmies() const;
+    Territory* getSource() const;
+    Territory* getDestination() const;
     bool validate() const;
+    std::vector<Territory*> getAffectedTerritories() const;
     OrderType getType() const;
 
 protected:
@@ -108,8 +120,8 @@ protected:
 
 private:
     int numberOfArmies_;
-    Territory* source_;
-    Territory* destination_;
+    TerritoryId sourceId_;
+    TerritoryId destinationId_;
 };
 
 
@@ -121,7 +133,9 @@ public:
     BombOrder(const BombOrder &order);
     const BombOrder &operator=(const BombOrder &order);
     Order* clone() const;
+    Territory* getTarget() const;
     bool validate() const;
+    std::vector<Territory*> getAffectedTerritories() const;
     OrderType getType() const;
 
 protected:
@@ -129,7 +143,7 @@ protected:
     std::ostream &print_(std::ostream &output) const;
 
 private:
-    Territory* target_;
+    TerritoryId targetId_;
 };
 
 
@@ -141,7 +155,9 @@ public:
     BlockadeOrder(const BlockadeOrder &order);
     const BlockadeOrder &operator=(const BlockadeOrder &order);
     Order* clone() const;
+    Territory* getTerritory() const;
     bool validate() const;
+    std::vector<Territory*> getAffectedTerritories() const;
     OrderType getType() const;
 
 protected:
@@ -149,7 +165,7 @@ protected:
     std::ostream &print_(std::ostream &output) const;
 
 private:
-    Territory* territory_;
+    TerritoryId territoryId_;
 };
 
 
@@ -161,7 +177,11 @@ public:
     AirliftOrder(const AirliftOrder &order);
     const AirliftOrder &operator=(const AirliftOrder &order);
     Order* clone() const;
+    int getNumberOfArmies() const;
+    Territory* getSource() const;
+    Territory* getDestination() const;
     bool validate() const;
+    std::vector<Territory*> getAffectedTerritories() const;
     OrderType getType() const;
 
 protected:
@@ -171,8 +191,8 @@ protected:
 
 private:
     int numberOfArmies_;
-    Territory* source_;
-    Territory* destination_;
+    TerritoryId sourceId_;
+    TerritoryId destinationId_;
 };
 
 
@@ -184,6 +204,7 @@ public:
     NegotiateOrder(const NegotiateOrder &order);
     const NegotiateOrder &operator=(const NegotiateOrder &order);
     Order* clone() const;
+    Player* getTarget() const;
     bool validate() const;
     OrderType getType() const;
 
@@ -192,5 +213,5 @@ protected:
     std::ostream &print_(std::ostream &output) const;
     
 private:
-    Player* target_;
+    PlayerId targetId_;
 };
\ No newline at end of file
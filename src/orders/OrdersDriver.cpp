@@ -11,6 +11,11 @@ int main()
     t2->addArmies(5);
     t3->addArmies(10);
 
+    // Orders refer to territories by id, so the territories must be part of the game's map
+    Continent* continent = new Continent("Canada", 3);
+    continent->setTerritories({ t1, t2, t3 });
+    GameEngine::setMap(new Map({ continent }, { { t1, { t2, t3 } }, { t2, { t1 } }, { t3, { t1 } } }));
+
     Player* player = new Player("Bob");
     Player* enemy = new Player("Alice");
     player->addOwnedTerritory(t1);
@@ -55,9 +60,6 @@ int main()
         std::cout << *order << std::endl;
     }
 
-    delete t1;
-    delete t2;
-    delete t3;
     GameEngine::resetGameEngine();
 
     return 0;
@@ -0,0 +1,142 @@
+#include "IssuedMovesLedger.h"
+#include <utility>
+
+namespace
+{
+    const int INITIAL_ADVANCE_SLOTS = 16;
+
+    // Key of the advance from `source` to `destination`
+    uint64_t getAdvanceKey(TerritoryId source, TerritoryId destination)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(source)) << 32) | static_cast<uint32_t>(destination);
+    }
+
+    // Spread the bits of a key over the whole word (the finalizer of SplitMix64), since ids are small and consecutive
+    uint64_t hashAdvanceKey(uint64_t key)
+    {
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+        return key ^ (key >> 31);
+    }
+}
+
+
+/*
+===================================
+ Implementation for IssuedMovesLedger class
+===================================
+ */
+
+// Constructors. Epoch 0 marks the slots that were never used, so the first turn is epoch 1.
+IssuedMovesLedger::IssuedMovesLedger() : epoch_(1), numberOfDeployments_(0), numberOfAdvances_(0) {}
+
+std::ostream &operator<<(std::ostream &output, const IssuedMovesLedger &ledger)
+{
+    output << "[IssuedMovesLedger] " << ledger.numberOfDeployments_ << " deployments, " << ledger.numberOfAdvances_ << " advances";
+    return output;
+}
+
+// Getters
+int IssuedMovesLedger::getNumberOfDeployments() const
+{
+    return numberOfDeployments_;
+}
+
+int IssuedMovesLedger::getNumberOfAdvances() const
+{
+    return numberOfAdvances_;
+}
+
+// Check if a deployment to `territory` was issued this turn
+bool IssuedMovesLedger::hasDeployedTo(TerritoryId territory) const
+{
+    return territory >= 0 && territory < static_cast<int>(deploymentEpochs_.size()) && deploymentEpochs_[territory] == epoch_;
+}
+
+// Check if an advance from `source` to `destination` was issued this turn
+bool IssuedMovesLedger::hasAdvanced(TerritoryId source, TerritoryId destination) const
+{
+    if (numberOfAdvances_ == 0)
+    {
+        return false;
+    }
+
+    int slot = findAdvanceSlot_(getAdvanceKey(source, destination));
+    return advanceSlots_[slot].epoch == epoch_;
+}
+
+// Record a deployment to `territory`
+void IssuedMovesLedger::recordDeployment(TerritoryId territory)
+{
+    if (territory < 0 || hasDeployedTo(territory))
+    {
+        return;
+    }
+
+    if (territory >= static_cast<int>(deploymentEpochs_.size()))
+    {
+        deploymentEpochs_.resize(territory + 1, 0);
+    }
+    deploymentEpochs_[territory] = epoch_;
+    numberOfDeployments_++;
+}
+
+// Record an advance from `source` to `destination`
+void IssuedMovesLedger::recordAdvance(TerritoryId source, TerritoryId destination)
+{
+    // Keep the table at most half full, so that probe sequences stay short
+    if ((numberOfAdvances_ + 1) * 2 > static_cast<int>(advanceSlots_.size()))
+    {
+        growAdvanceSlots_();
+    }
+
+    uint64_t key = getAdvanceKey(source, destination);
+    AdvanceSlot &slot = advanceSlots_[findAdvanceSlot_(key)];
+    if (slot.epoch != epoch_)
+    {
+        slot = { key, epoch_ };
+        numberOfAdvances_++;
+    }
+}
+
+// Forget every move of the turn by starting a new epoch. Stamps are only reset when the epoch counter wraps around.
+void IssuedMovesLedger::clear()
+{
+    epoch_++;
+    if (epoch_ == 0)
+    {
+        deploymentEpochs_.assign(deploymentEpochs_.size(), 0);
+        advanceSlots_.assign(advanceSlots_.size(), { 0, 0 });
+        epoch_ = 1;
+    }
+    numberOfDeployments_ = 0;
+    numberOfAdvances_ = 0;
+}
+
+// Index of the slot holding `key` in this epoch, or of the empty slot where it would go. Slots of past epochs are empty.
+int IssuedMovesLedger::findAdvanceSlot_(uint64_t key) const
+{
+    int mask = advanceSlots_.size() - 1;
+    int slot = hashAdvanceKey(key) & mask;
+    while (advanceSlots_[slot].epoch == epoch_ && advanceSlots_[slot].key != key)
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+// Double the number of advance slots, carrying over the advances of this epoch only
+void IssuedMovesLedger::growAdvanceSlots_()
+{
+    std::vector<AdvanceSlot> oldSlots = std::move(advanceSlots_);
+    int capacity = oldSlots.empty() ? INITIAL_ADVANCE_SLOTS : oldSlots.size() * 2;
+    advanceSlots_.assign(capacity, { 0, 0 });
+
+    for (const auto &oldSlot : oldSlots)
+    {
+        if (oldSlot.epoch == epoch_)
+        {
+            advanceSlots_[findAdvanceSlot_(oldSlot.key)] = oldSlot;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../game_engine/Handles.h"
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// The deployments and advances a player has issued during the current turn, so that its strategy does not issue the same
+// move twice. Deployments are stamped per territory and advances are kept in an open-addressing table of (source,
+// destination) pairs, so every lookup is O(1). Entries are stamped with the turn's epoch: clearing the ledger at the end of
+// a turn only starts a new epoch, and the entries of past turns are treated as empty slots.
+class IssuedMovesLedger
+{
+public:
+    IssuedMovesLedger();
+    friend std::ostream &operator<<(std::ostream &output, const IssuedMovesLedger &ledger);
+    int getNumberOfDeployments() const;
+    int getNumberOfAdvances() const;
+    bool hasDeployedTo(TerritoryId territory) const;
+    bool hasAdvanced(TerritoryId source, TerritoryId destination) const;
+    void recordDeployment(TerritoryId territory);
+    void recordAdvance(TerritoryId source, TerritoryId destination);
+    void clear();
+
+private:
+    // An advance recorded in the epoch `epoch`
+    struct AdvanceSlot
+    {
+        uint64_t key;
+        unsigned int epoch;
+    };
+
+    unsigned int epoch_;
+    int numberOfDeployments_;
+    int numberOfAdvances_;
+    std::vector<unsigned int> deploymentEpochs_;
+    std::vector<AdvanceSlot> advanceSlots_;
+    int findAdvanceSlot_(uint64_t key) const;
+    void growAdvanceSlots_();
+};
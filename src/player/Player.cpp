@@ -1,45 +1,81 @@
 #include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
 #include "../orders/Orders.h"
+#include "../profiling/AllocationTracker.h"
+#include "../profiling/Profiler.h"
+#include "../profiling/Tracer.h"
+#include "../recorder/GameRecorder.h"
 #include "Player.h"
 #include <algorithm>
 #include <math.h>
 #include <sstream>
+#include <utility>
 
+namespace
+{
+    // Where the ownership changes made on this thread go instead of being applied, if anywhere
+    thread_local std::vector<OwnershipChange>* deferredOwnershipChanges = nullptr;
+}
 
 // Constructors
 Player::Player()
-    : reinforcements_(0),
-      name_("Neutral Player"),
+    : name_("Neutral Player"),
+      id_(NO_PLAYER_ID),
+      reinforcements_(0),
+      committed_(false),
+      strategy_(new NeutralPlayerStrategy()),
       orders_(new OrdersList()),
       hand_(new Hand()),
-      committed_(false),
-      strategy_(new NeutralPlayerStrategy()) {}
+      issuingAhead_(false) {}
 
 Player::Player(std::string name)
-    : reinforcements_(0),
-      name_(name),
+    : name_(std::move(name)),
+      id_(NO_PLAYER_ID),
+      reinforcements_(0),
+      committed_(false),
+      strategy_(new NeutralPlayerStrategy()),
       orders_(new OrdersList()),
       hand_(new Hand()),
-      committed_(false),
-      strategy_(new NeutralPlayerStrategy()) {}
+      issuingAhead_(false) {}
 
 Player::Player(std::string name, PlayerStrategy* strategy)
-    : reinforcements_(0),
-      name_(name),
+    : name_(std::move(name)),
+      id_(NO_PLAYER_ID),
+      reinforcements_(0),
+      committed_(false),
+      strategy_(strategy),
       orders_(new OrdersList()),
       hand_(new Hand()),
-      committed_(false),
-      strategy_(strategy) {}
+      issuingAhead_(false) {}
 
 Player::Player(const Player &player)
-    : reinforcements_(player.reinforcements_),
-      name_(player.name_),
-      ownedTerritories_(player.ownedTerritories_),
+    : name_(player.name_),
+      id_(player.id_),
+      reinforcements_(player.reinforcements_),
+      committed_(player.committed_),
+      strategy_(player.strategy_->clone()),
       orders_(new OrdersList(*player.orders_)),
       hand_(new Hand(*player.hand_)),
-      diplomaticRelations_(player.diplomaticRelations_),
+      ownedTerritories_(player.ownedTerritories_),
+      territoriesByStrength_(player.territoriesByStrength_),
+      random_(player.random_),
+      issuingAhead_(false) {}
+
+// A moved player takes over the territories, orders, cards and strategy of `player`, which is left with nothing and can
+// only be destroyed or assigned to. The orders keep `player` as their issuer.
+Player::Player(Player &&player) noexcept
+    : name_(std::move(player.name_)),
+      id_(player.id_),
+      reinforcements_(player.reinforcements_),
       committed_(player.committed_),
-      strategy_(player.strategy_->clone()) {}
+      strategy_(nullptr),
+      orders_(nullptr),
+      hand_(nullptr),
+      random_(player.random_),
+      issuingAhead_(false)
+{
+    takeOver_(player);
+}
 
 // Destructor
 Player::~Player()
@@ -65,7 +101,31 @@ const Player &Player::operator=(const Player &player)
         strategy_ = player.strategy_->clone();
         reinforcements_ = player.reinforcements_;
         name_ = player.name_;
+        id_ = player.id_;
         ownedTerritories_ = player.ownedTerritories_;
+        territoriesByStrength_ = player.territoriesByStrength_;
+        random_ = player.random_;
+    }
+    return *this;
+}
+
+const Player &Player::operator=(Player &&player) noexcept
+{
+    if (this != &player)
+    {
+        for (const auto &territory : ownedTerritories_)
+        {
+            territory->setOwner(territory->getOwner() == this ? nullptr : territory->getOwner());
+        }
+        delete orders_;
+        delete hand_;
+        delete strategy_;
+        name_ = std::move(player.name_);
+        id_ = player.id_;
+        reinforcements_ = player.reinforcements_;
+        committed_ = player.committed_;
+        random_ = player.random_;
+        takeOver_(player);
     }
     return *this;
 }
@@ -83,11 +143,32 @@ std::vector<Territory*> Player::getOwnedTerritories() const
     return ownedTerritories_;
 }
 
+int Player::getNumberOfOwnedTerritories() const
+{
+    return ownedTerritories_.size();
+}
+
+int Player::getNumberOfOrders() const
+{
+    return orders_->size();
+}
+
+int Player::getNumberOfCards() const
+{
+    return hand_->size();
+}
+
 std::string Player::getName() const
 {
     return name_;
 }
 
+// The player's handle in the game, or NO_PLAYER_ID if it has not joined one (see GameEngine::getPlayer())
+PlayerId Player::getId() const
+{
+    return id_;
+}
+
 OrdersList Player::getOrdersList() const
 {
     return *orders_;
@@ -98,9 +179,16 @@ Hand Player::getHand() const
     return *hand_;
 }
 
-std::vector<Player*> Player::getDiplomaticRelations() const
+// Ids of the players this player cannot attack until the end of the turn, which the game keeps track of
+std::vector<PlayerId> Player::getDiplomaticRelations() const
 {
-    return diplomaticRelations_;
+    return GameEngine::getDiplomacy()->getRelations(id_);
+}
+
+// Check if this player cannot attack `player` until the end of the turn
+bool Player::hasDiplomaticRelation(const Player* player) const
+{
+    return player != nullptr && GameEngine::getDiplomacy()->hasRelation(id_, player->id_);
 }
 
 int Player::getReinforcements() const
@@ -108,13 +196,41 @@ int Player::getReinforcements() const
     return reinforcements_;
 }
 
+TurnSnapshot Player::getTurnSnapshot() const
+{
+    return { getNumberOfOrders(), reinforcements_, getNumberOfCards() };
+}
+
+// What the Player had before the `turn`th call to issueOrder() made by issueAllOrders(). Empty in headless builds.
+TurnSnapshot Player::getIssuedTurnSnapshot(int turn) const
+{
+    return issuedTurns_.at(turn).start;
+}
+
 // Setter
+void Player::setId(PlayerId id)
+{
+    id_ = id;
+}
+
 void Player::setStrategy(PlayerStrategy* strategy)
 {
     delete strategy_;
     strategy_ = strategy;
 }
 
+// Seed the Player's own random number generator. Players do not share the global one, so that they can issue orders concurrently.
+void Player::setSeed(unsigned int seed)
+{
+    random_.seed(seed);
+}
+
+// Return a random index in a container of `size` elements
+int Player::getRandomIndex(int size)
+{
+    return std::uniform_int_distribution<int>(0, size - 1)(random_);
+}
+
 // Add a number of reinforcements to the Player's reinforcement pool
 void Player::addReinforcements(int reinforcements)
 {
@@ -124,34 +240,105 @@ void Player::addReinforcements(int reinforcements)
 // Add a territory to the Player's list of owned territories
 void Player::addOwnedTerritory(Territory* territory)
 {
+    if (deferredOwnershipChanges != nullptr)
+    {
+        deferredOwnershipChanges->push_back({ this, territory, true });
+        return;
+    }
+
     ownedTerritories_.push_back(territory);
+    territoriesByStrength_.add(territory);
+    territory->setOwner(this);
+
+    GameRecorder* recorder = GameEngine::getRecorder();
+    if (recorder != nullptr)
+    {
+        recorder->recordOwnershipChange(territory, this);
+    }
 }
 
 // Remove a territory from the Player's list of owned territories
 void Player::removeOwnedTerritory(Territory* territory)
 {
+    if (deferredOwnershipChanges != nullptr)
+    {
+        deferredOwnershipChanges->push_back({ this, territory, false });
+        return;
+    }
+
     auto removeIterator = remove(ownedTerritories_.begin(), ownedTerritories_.end(), territory);
     ownedTerritories_.erase(removeIterator, ownedTerritories_.end());
+    territoriesByStrength_.remove(territory);
+
+    // The territory may already have been handed to its new owner
+    if (territory->getOwner() == this)
+    {
+        territory->setOwner(nullptr);
+    }
+}
+
+// Refile one of the Player's territories after the number of armies on it changed. While ownership changes are deferred,
+// orders of the Player may be moving armies on other threads, so the GameEngine updates the territories they affected
+// once they are done instead.
+void Player::updateTerritoryStrength(Territory* territory)
+{
+    if (deferredOwnershipChanges == nullptr)
+    {
+        territoriesByStrength_.update(territory);
+    }
+}
+
+// Put the territories captured during a phase whose ownership changes were deferred back in the order they were
+// captured in. `captureIndices` holds when each territory was last captured; the others were owned before the phase
+// and stay first, as they would have.
+void Player::sortCapturedTerritories(const std::unordered_map<Territory*, int> &captureIndices)
+{
+    auto getCaptureIndex = [&captureIndices](Territory* territory) {
+        auto iterator = captureIndices.find(territory);
+        return iterator == captureIndices.end() ? -1 : iterator->second;
+    };
+    auto sortLambda = [&getCaptureIndex](auto t1, auto t2) { return getCaptureIndex(t1) < getCaptureIndex(t2); };
+    stable_sort(ownedTerritories_.begin(), ownedTerritories_.end(), sortLambda);
 }
 
 // Add an enemy player to the list of diplomatic relations for this player
 void Player::addDiplomaticRelation(Player* player)
 {
-    diplomaticRelations_.push_back(player);
+    GameEngine::getDiplomacy()->addRelation(id_, player->getId());
 }
 
-// Clear the list of diplomatic relations and the map of issued orders to territories
+// Clear the list of diplomatic relations, the ledger of issued moves and the turns issued ahead
 void Player::endTurn()
 {
-    diplomaticRelations_.clear();
-    issuedDeploymentsAndAdvancements_.clear();
+    GameEngine::getDiplomacy()->clearRelations(id_);
+    issuedMoves_.clear();
+    issuedTurns_.clear();
     committed_ = false;
+
+    GameRecorder* recorder = GameEngine::getRecorder();
+    if (recorder != nullptr)
+    {
+        recorder->recordTurnEnd(this);
+    }
 }
 
 // Add an order to the player's list of orders
 void Player::addOrder(Order* order)
 {
     orders_->add(order);
+    PROFILE_COUNT_ORDER(ORDERS_ISSUED_COUNTER, order);
+
+    if (issuingAhead_)
+    {
+        issuedTurns_.back().orders.push_back(order);
+        return;
+    }
+
+    GameRecorder* recorder = GameEngine::getRecorder();
+    if (recorder != nullptr)
+    {
+        recorder->recordOrderIssued(order);
+    }
 }
 
 // Remove and return the next order to be executed from the Player's list of orders
@@ -160,24 +347,51 @@ Order* Player::getNextOrder()
     return orders_->popTopOrder();
 }
 
+// Remove every order from the Player's list of orders and return them in the order they should be executed
+std::vector<Order*> Player::getAllOrders()
+{
+    return orders_->popAllOrders();
+}
+
 // Return the next order from the Player's list of orders without removing it from the list
 Order* Player::peekNextOrder()
 {
     return orders_->peek();
 }
 
-// Draw a random card from the deck and place it in the Player's hand
-void Player::drawCardFromDeck()
+// Draw a random card from the deck and place it in the Player's hand. Returns the card, or nullptr if none was drawn.
+const Card* Player::drawCardFromDeck()
 {
-    if (!isNeutral())
+    if (isNeutral())
     {
-        Card* card = GameEngine::getDeck()->draw();
-        if (card != nullptr)
+        return nullptr;
+    }
+
+    const Card* card = GameEngine::getDeck()->draw();
+    if (card != nullptr)
+    {
+        hand_->addCard(card->getType());
+
+        GameRecorder* recorder = GameEngine::getRecorder();
+        if (recorder != nullptr)
         {
-            card->setOwner(this);
-            hand_->addCard(card);
+            recorder->recordCardDrawn(this, card);
         }
     }
+
+    return card;
+}
+
+// Return a card played from the Player's hand to the deck
+void Player::returnCardToDeck(const Card* card)
+{
+    if (issuingAhead_)
+    {
+        issuedTurns_.back().cardsPlayed.push_back(card->getType());
+        return;
+    }
+
+    GameEngine::getDeck()->addCard(card->getType());
 }
 
 // Check whether the player is human or not
@@ -194,6 +408,13 @@ bool Player::isNeutral() const
     return neutral != nullptr;
 }
 
+// Check whether the player's orders are issued by a client playing over an InputChannel
+bool Player::isRemote() const
+{
+    RemotePlayerStrategy* remote = dynamic_cast<RemotePlayerStrategy*>(strategy_);
+    return remote != nullptr;
+}
+
 // Check if the player is finished issuing orders
 bool Player::isDoneIssuingOrders() const
 {
@@ -231,25 +452,116 @@ std::vector<Territory*> Player::toAttack() const
 // Create an order and place it in the Player's list of orders
 void Player::issueOrder()
 {
+    PROFILE_SCOPE(STRATEGY_SECTION);
+    TRACE_SCOPE("issueOrder", "strategy");
+    ALLOCATION_SCOPE(STRATEGY_TAG);
+
     int oldNumberOfOrders = orders_->size();
 
     strategy_->issueOrder(this);
 
     if (oldNumberOfOrders == orders_->size())
     {
-        std::cout << "No new order issued." << std::endl;
+        LOG_INFO("No new order issued.\n");
     }
 }
 
-// Check if the player has already issued an advance order from `source` to `destination`
-bool Player::advancePairingExists_(Territory* source, Territory* destination)
+// Create an order like issueOrder(), suspending the calling coroutine while the strategy waits for input
+GameTask Player::issueOrderAsync()
 {
-    auto issuedIterator = issuedDeploymentsAndAdvancements_.find(source);
-    if (issuedIterator != issuedDeploymentsAndAdvancements_.end())
+    return strategy_->issueOrderAsync(this);
+}
+
+// Issue orders until the Player is done for this turn, without touching the deck or the recorder, which are shared with
+// the other players. This lets several AI players issue their orders concurrently. The orders issued and cards played by
+// each call to issueOrder() are kept aside until the GameEngine publishes them with publishIssuedTurn().
+void Player::issueAllOrders()
+{
+    issuedTurns_.clear();
+    issuingAhead_ = true;
+    while (!isDoneIssuingOrders())
+    {
+        // The snapshot is only ever published, so headless builds leave it empty
+        issuedTurns_.push_back({ {}, {}, {} });
+        if constexpr (EVENTS_ENABLED)
+        {
+            issuedTurns_.back().start = getTurnSnapshot();
+        }
+        issueOrder();
+    }
+    issuingAhead_ = false;
+}
+
+// Record the orders and return the cards played of the `turn`th call to issueOrder() made by issueAllOrders().
+// Returns `false` if the Player was done issuing orders by then.
+bool Player::publishIssuedTurn(int turn)
+{
+    if (turn >= static_cast<int>(issuedTurns_.size()))
+    {
+        return false;
+    }
+
+    GameRecorder* recorder = GameEngine::getRecorder();
+    if (recorder != nullptr)
+    {
+        for (const auto &order : issuedTurns_.at(turn).orders)
+        {
+            recorder->recordOrderIssued(order);
+        }
+    }
+    for (const auto &type : issuedTurns_.at(turn).cardsPlayed)
+    {
+        GameEngine::getDeck()->addCard(type);
+    }
+
+    return true;
+}
+
+// Keep the territories gained and lost on the calling thread in `changes` rather than updating the players' lists of owned
+// territories, which orders executing on other threads may be reading. Pass nullptr to update the lists directly again.
+void Player::deferOwnershipChanges(std::vector<OwnershipChange>* changes)
+{
+    deferredOwnershipChanges = changes;
+}
+
+// Apply the ownership changes kept by deferOwnershipChanges(), in order
+void Player::applyOwnershipChanges(const std::vector<OwnershipChange> &changes)
+{
+    for (const auto &change : changes)
     {
-        std::vector<Territory*> pastAdvancements = issuedIterator->second;
-        return find(pastAdvancements.begin(), pastAdvancements.end(), destination) != pastAdvancements.end();
+        if (change.added)
+        {
+            change.player->addOwnedTerritory(change.territory);
+        }
+        else
+        {
+            change.player->removeOwnedTerritory(change.territory);
+        }
     }
+}
+
+// Take over what `player` holds when it is moved, pointing its territories at this player instead
+void Player::takeOver_(Player &player)
+{
+    strategy_ = player.strategy_;
+    orders_ = player.orders_;
+    hand_ = player.hand_;
+    player.strategy_ = nullptr;
+    player.orders_ = nullptr;
+    player.hand_ = nullptr;
+
+    ownedTerritories_ = std::move(player.ownedTerritories_);
+    territoriesByStrength_ = std::move(player.territoriesByStrength_);
+    issuedMoves_ = std::move(player.issuedMoves_);
+    issuingAhead_ = player.issuingAhead_;
+    issuedTurns_ = std::move(player.issuedTurns_);
+    player.ownedTerritories_.clear();
+    player.issuedMoves_.clear();
+    player.issuingAhead_ = false;
+    player.issuedTurns_.clear();
 
-    return false;
+    for (const auto &territory : ownedTerritories_)
+    {
+        territory->setOwner(territory->getOwner() == &player ? this : territory->getOwner());
+    }
 }
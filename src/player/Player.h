@@ -1,9 +1,13 @@
 #pragma once
 
 #include "../cards/Cards.h"
+#include "../game_engine/GameTask.h"
 #include "../map/Map.h"
 #include "../orders/Orders.h"
 #include "../strategies/PlayerStrategies.h"
+#include "IssuedMovesLedger.h"
+#include "TerritoryStrengthIndex.h"
+#include <random>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -12,6 +16,7 @@ class AggressivePlayerStrategy;
 class BenevolentPlayerStrategy;
 class HumanPlayerStrategy;
 class PlayerStrategy;
+class RemotePlayerStrategy;
 class Card;
 class Deck;
 class Hand;
@@ -21,53 +26,109 @@ class DeployOrder;
 class Order;
 class OrdersList;
 
+class Player;
+enum CardType : short;
+
+// A territory changing hands while ownership changes are deferred (see Player::deferOwnershipChanges())
+struct OwnershipChange
+{
+    Player* player;
+    Territory* territory;
+    bool added;
+};
+
+// What a player has as one of its turns starts, as observers display it
+struct TurnSnapshot
+{
+    int orders;
+    int reinforcements;
+    int cards;
+};
+
+
 class Player
 {
     friend class AggressivePlayerStrategy;
     friend class BenevolentPlayerStrategy;
     friend class HumanPlayerStrategy;
+    friend class RemotePlayerStrategy;
 
     public:
         Player();
         Player(std::string name);
         Player(std::string name, PlayerStrategy* strategy);
         Player(const Player &player);
+        Player(Player &&player) noexcept;
         ~Player();
         const Player &operator=(const Player &player);
+        const Player &operator=(Player &&player) noexcept;
         friend std::ostream &operator<<(std::ostream &output, const Player &player);
         std::vector<Territory*> getOwnedTerritories() const;
+        int getNumberOfOwnedTerritories() const;
+        int getNumberOfOrders() const;
+        int getNumberOfCards() const;
         std::string getName() const;
+        PlayerId getId() const;
         OrdersList getOrdersList() const;
         Hand getHand() const;
-        std::vector<Player*> getDiplomaticRelations() const;
+        std::vector<PlayerId> getDiplomaticRelations() const;
+        bool hasDiplomaticRelation(const Player* player) const;
         int getReinforcements() const;
+        TurnSnapshot getTurnSnapshot() const;
+        TurnSnapshot getIssuedTurnSnapshot(int turn) const;
+        void setId(PlayerId id);
         void setStrategy(PlayerStrategy* strategy);
+        void setSeed(unsigned int seed);
+        int getRandomIndex(int size);
         void addReinforcements(int reinforcements);
         void addOwnedTerritory(Territory* territory);
         void removeOwnedTerritory(Territory* territory);
+        void updateTerritoryStrength(Territory* territory);
+        void sortCapturedTerritories(const std::unordered_map<Territory*, int> &captureIndices);
         void addDiplomaticRelation(Player* player);
         void endTurn();
         void addOrder(Order* order);
         Order* getNextOrder();
+        std::vector<Order*> getAllOrders();
         Order* peekNextOrder();
-        void drawCardFromDeck();
+        const Card* drawCardFromDeck();
+        void returnCardToDeck(const Card* card);
         bool isHuman() const;
         bool isNeutral() const;
+        bool isRemote() const;
         bool isDoneIssuingOrders() const;
         std::vector<Territory*> getOwnTerritoriesWithMovableArmies() const;
         std::vector<Territory*> toDefend() const;
         std::vector<Territory*> toAttack() const;
         void issueOrder();
+        GameTask issueOrderAsync();
+        void issueAllOrders();
+        bool publishIssuedTurn(int turn);
+        static void deferOwnershipChanges(std::vector<OwnershipChange>* changes);
+        static void applyOwnershipChanges(const std::vector<OwnershipChange> &changes);
 
     private:
+        // Orders issued and cards played in one call to issueOrder() while issuing all orders ahead of the other players,
+        // and what the player had before that call
+        struct IssuedTurn
+        {
+            std::vector<Order*> orders;
+            std::vector<CardType> cardsPlayed;
+            TurnSnapshot start;
+        };
+
         std::string name_;
+        PlayerId id_;
         int reinforcements_;
         bool committed_;
         PlayerStrategy* strategy_;
         OrdersList* orders_;
         Hand* hand_;
         std::vector<Territory*> ownedTerritories_;
-        std::vector<Player*> diplomaticRelations_;
-        std::unordered_map<Territory*, std::vector<Territory*>> issuedDeploymentsAndAdvancements_;
-        bool advancePairingExists_(Territory* source, Territory* destination);
+        TerritoryStrengthIndex territoriesByStrength_;
+        IssuedMovesLedger issuedMoves_;
+        std::mt19937 random_;
+        bool issuingAhead_;
+        std::vector<IssuedTurn> issuedTurns_;
+        void takeOver_(Player &player);
 };
@@ -0,0 +1,170 @@
+#include "TerritoryStrengthIndex.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+/*
+===================================
+ Implementation for TerritoryStrengthIndex class
+===================================
+ */
+
+// Constructors
+TerritoryStrengthIndex::TerritoryStrengthIndex() {}
+
+TerritoryStrengthIndex::TerritoryStrengthIndex(const TerritoryStrengthIndex &index)
+    : entries_(index.entries_), indexedEntries_(index.indexedEntries_) {}
+
+TerritoryStrengthIndex::TerritoryStrengthIndex(TerritoryStrengthIndex &&index) noexcept
+    : entries_(std::move(index.entries_)), indexedEntries_(std::move(index.indexedEntries_))
+{
+    index.clear();
+}
+
+// Operator overloading
+const TerritoryStrengthIndex &TerritoryStrengthIndex::operator=(const TerritoryStrengthIndex &index)
+{
+    if (this != &index)
+    {
+        entries_ = index.entries_;
+        indexedEntries_ = index.indexedEntries_;
+    }
+    return *this;
+}
+
+const TerritoryStrengthIndex &TerritoryStrengthIndex::operator=(TerritoryStrengthIndex &&index) noexcept
+{
+    if (this != &index)
+    {
+        entries_ = std::move(index.entries_);
+        indexedEntries_ = std::move(index.indexedEntries_);
+        index.clear();
+    }
+    return *this;
+}
+
+std::ostream &operator<<(std::ostream &output, const TerritoryStrengthIndex &index)
+{
+    output << "[TerritoryStrengthIndex] " << index.entries_.size() << " Territories";
+    if (!index.entries_.empty())
+    {
+        output << ", " << index.entries_.begin()->armies << " to " << index.entries_.rbegin()->armies << " Armies";
+    }
+    return output;
+}
+
+// Entries are ordered by armies, then by id. Territories outside of a map all have the same id, so their address
+// keeps them apart.
+bool TerritoryStrengthIndex::Entry::operator<(const Entry &entry) const
+{
+    if (armies != entry.armies)
+    {
+        return armies < entry.armies;
+    }
+    if (id != entry.id)
+    {
+        return id < entry.id;
+    }
+    return std::less<Territory*>()(territory, entry.territory);
+}
+
+// Getters
+int TerritoryStrengthIndex::size() const
+{
+    return entries_.size();
+}
+
+bool TerritoryStrengthIndex::contains(Territory* territory) const
+{
+    return indexedEntries_.find(territory) != indexedEntries_.end();
+}
+
+// The territory with the most armies, or nullptr if there are no territories
+Territory* TerritoryStrengthIndex::getStrongest() const
+{
+    return entries_.empty() ? nullptr : entries_.rbegin()->territory;
+}
+
+// The territory with the fewest armies, or nullptr if there are no territories
+Territory* TerritoryStrengthIndex::getWeakest() const
+{
+    return entries_.empty() ? nullptr : entries_.begin()->territory;
+}
+
+// The `count` territories with the most armies, strongest first
+std::vector<Territory*> TerritoryStrengthIndex::getStrongest(int count) const
+{
+    std::vector<Territory*> territories;
+    territories.reserve(std::min<int>(count, entries_.size()));
+    for (auto iterator = entries_.rbegin(); iterator != entries_.rend() && static_cast<int>(territories.size()) < count; iterator++)
+    {
+        territories.push_back(iterator->territory);
+    }
+    return territories;
+}
+
+// The `count` territories with the fewest armies, weakest first
+std::vector<Territory*> TerritoryStrengthIndex::getWeakest(int count) const
+{
+    std::vector<Territory*> territories;
+    territories.reserve(std::min<int>(count, entries_.size()));
+    for (auto iterator = entries_.begin(); iterator != entries_.end() && static_cast<int>(territories.size()) < count; iterator++)
+    {
+        territories.push_back(iterator->territory);
+    }
+    return territories;
+}
+
+// Index `territory` under its current number of armies. Territories already in the index are updated instead.
+void TerritoryStrengthIndex::add(Territory* territory)
+{
+    if (contains(territory))
+    {
+        update(territory);
+        return;
+    }
+
+    Entry entry = { territory->getNumberOfArmies(), territory->getId(), territory };
+    entries_.insert(entry);
+    indexedEntries_[territory] = entry;
+}
+
+void TerritoryStrengthIndex::remove(Territory* territory)
+{
+    auto iterator = indexedEntries_.find(territory);
+    if (iterator == indexedEntries_.end())
+    {
+        return;
+    }
+
+    entries_.erase(iterator->second);
+    indexedEntries_.erase(iterator);
+}
+
+// Move `territory` to where its current number of armies puts it. The entry's node is reused, so this does not allocate.
+void TerritoryStrengthIndex::update(Territory* territory)
+{
+    auto iterator = indexedEntries_.find(territory);
+    if (iterator == indexedEntries_.end())
+    {
+        return;
+    }
+
+    Entry &entry = iterator->second;
+    if (entry.armies == territory->getNumberOfArmies() && entry.id == territory->getId())
+    {
+        return;
+    }
+
+    auto node = entries_.extract(entry);
+    entry.armies = territory->getNumberOfArmies();
+    entry.id = territory->getId();
+    node.value() = entry;
+    entries_.insert(std::move(node));
+}
+
+void TerritoryStrengthIndex::clear()
+{
+    entries_.clear();
+    indexedEntries_.clear();
+}
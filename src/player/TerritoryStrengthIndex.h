@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../map/Map.h"
+#include <iostream>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+class Territory;
+
+// A player's territories ordered by the number of armies on them, kept up to date as armies move (see
+// Player::updateTerritoryStrength()) rather than sorted whenever a strategy needs them. The strongest and weakest
+// territories are found in O(1), the k strongest or weakest in O(k), and moving armies costs O(log n).
+// Territories with as many armies are ordered by id, so that strategies pick the same territories on every run.
+class TerritoryStrengthIndex
+{
+public:
+    TerritoryStrengthIndex();
+    TerritoryStrengthIndex(const TerritoryStrengthIndex &index);
+    TerritoryStrengthIndex(TerritoryStrengthIndex &&index) noexcept;
+    const TerritoryStrengthIndex &operator=(const TerritoryStrengthIndex &index);
+    const TerritoryStrengthIndex &operator=(TerritoryStrengthIndex &&index) noexcept;
+    friend std::ostream &operator<<(std::ostream &output, const TerritoryStrengthIndex &index);
+    int size() const;
+    bool contains(Territory* territory) const;
+    Territory* getStrongest() const;
+    Territory* getWeakest() const;
+    std::vector<Territory*> getStrongest(int count) const;
+    std::vector<Territory*> getWeakest(int count) const;
+    void add(Territory* territory);
+    void remove(Territory* territory);
+    void update(Territory* territory);
+    void clear();
+
+private:
+    // A territory, filed under the number of armies and the id it had when it was last updated
+    struct Entry
+    {
+        int armies;
+        TerritoryId id;
+        Territory* territory;
+        bool operator<(const Entry &entry) const;
+    };
+
+    std::set<Entry> entries_;
+    std::unordered_map<Territory*, Entry> indexedEntries_;
+};
@@ -0,0 +1,236 @@
+#include "AllocationTracker.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <sstream>
+
+namespace
+{
+    const std::string TAG_NAMES[NUMBER_OF_ALLOCATION_TAGS] = {
+        "Outside phases",
+        "Startup phase",
+        "Reinforcement phase",
+        "Issue orders phase",
+        "Execute orders phase",
+        "Other",
+        "Map loading",
+        "Strategies",
+        "Order execution",
+        "Cards",
+        "Observers"
+    };
+
+    // Prefixed to every block. Its size keeps the memory handed out aligned like malloc's.
+    struct alignas(alignof(std::max_align_t)) AllocationHeader
+    {
+        uint64_t size;
+        AllocationTag phase;
+        AllocationTag subsystem;
+        bool tracked;
+    };
+
+    std::atomic<uint64_t> allocationCount(0);
+    std::atomic<uint64_t> bytesAllocated(0);
+    std::atomic<bool> trackingEnabled(false);
+    std::atomic<int64_t> liveBytes(0);
+    std::atomic<int64_t> peakLiveBytes(0);
+    std::atomic<uint64_t> tagAllocations[NUMBER_OF_ALLOCATION_TAGS];
+    std::atomic<uint64_t> tagBytes[NUMBER_OF_ALLOCATION_TAGS];
+    std::atomic<uint64_t> tagFrees[NUMBER_OF_ALLOCATION_TAGS];
+    std::atomic<int64_t> tagLiveBytes[NUMBER_OF_ALLOCATION_TAGS];
+    std::atomic<int64_t> tagPeakLiveBytes[NUMBER_OF_ALLOCATION_TAGS];
+
+    thread_local AllocationTag currentPhase = NO_PHASE_TAG;
+    thread_local AllocationTag currentSubsystem = OTHER_TAG;
+
+    // Raise `maximum` to `value` if it is larger
+    void updateMaximum(std::atomic<int64_t> &maximum, int64_t value)
+    {
+        int64_t current = maximum.load(std::memory_order_relaxed);
+        while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    void addAllocation(AllocationTag tag, int64_t size)
+    {
+        tagAllocations[tag].fetch_add(1, std::memory_order_relaxed);
+        tagBytes[tag].fetch_add(size, std::memory_order_relaxed);
+        updateMaximum(tagPeakLiveBytes[tag], tagLiveBytes[tag].fetch_add(size, std::memory_order_relaxed) + size);
+    }
+
+    void addFree(AllocationTag tag, int64_t size)
+    {
+        tagFrees[tag].fetch_add(1, std::memory_order_relaxed);
+        tagLiveBytes[tag].fetch_sub(size, std::memory_order_relaxed);
+    }
+}
+
+// Replacement allocation functions. Everything else is left to malloc.
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+
+    AllocationHeader* header = static_cast<AllocationHeader*>(std::malloc(sizeof(AllocationHeader) + size));
+    if (header == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    header->size = size;
+    header->tracked = trackingEnabled.load(std::memory_order_relaxed);
+    if (header->tracked)
+    {
+        header->phase = currentPhase;
+        header->subsystem = currentSubsystem;
+        updateMaximum(peakLiveBytes, liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+        addAllocation(header->phase, size);
+        addAllocation(header->subsystem, size);
+    }
+
+    return header + 1;
+}
+
+void operator delete(void* memory) noexcept
+{
+    if (memory == nullptr)
+    {
+        return;
+    }
+
+    AllocationHeader* header = static_cast<AllocationHeader*>(memory) - 1;
+    if (header->tracked)
+    {
+        liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+        addFree(header->phase, header->size);
+        addFree(header->subsystem, header->size);
+    }
+    std::free(header);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    operator delete(memory);
+}
+
+
+/*
+===================================
+ Implementation for AllocationTracker class
+===================================
+ */
+
+// Allocations made so far, whether tracking is enabled or not
+uint64_t AllocationTracker::getAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationTracker::getBytesAllocated()
+{
+    return bytesAllocated.load(std::memory_order_relaxed);
+}
+
+bool AllocationTracker::isEnabled()
+{
+    return trackingEnabled.load(std::memory_order_relaxed);
+}
+
+// Start or stop attributing allocations to tags. Blocks allocated while tracking was disabled are never attributed.
+void AllocationTracker::setEnabled(bool enabled)
+{
+    trackingEnabled = enabled;
+}
+
+// Bytes of tracked allocations that have not been freed yet
+int64_t AllocationTracker::getLiveBytes()
+{
+    return liveBytes.load(std::memory_order_relaxed);
+}
+
+int64_t AllocationTracker::getPeakLiveBytes()
+{
+    return peakLiveBytes.load(std::memory_order_relaxed);
+}
+
+AllocationTagStats AllocationTracker::getStats(AllocationTag tag)
+{
+    AllocationTagStats stats;
+    stats.allocations = tagAllocations[tag].load(std::memory_order_relaxed);
+    stats.bytesAllocated = tagBytes[tag].load(std::memory_order_relaxed);
+    stats.frees = tagFrees[tag].load(std::memory_order_relaxed);
+    stats.liveBytes = tagLiveBytes[tag].load(std::memory_order_relaxed);
+    stats.peakLiveBytes = tagPeakLiveBytes[tag].load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::string AllocationTracker::getTagName(AllocationTag tag)
+{
+    return TAG_NAMES[tag];
+}
+
+// Build the report of the allocations tracked since the last reset
+std::string AllocationTracker::getReport()
+{
+    std::ostringstream output;
+    report(output);
+    return output.str();
+}
+
+void AllocationTracker::report(std::ostream &output)
+{
+    output << "\n===== Allocations: " << getLiveBytes() << " live bytes, peak " << getPeakLiveBytes() << " =====\n";
+    output << std::left << std::setw(24) << "Tag" << std::right << std::setw(14) << "Allocations" << std::setw(16) << "Bytes";
+    output << std::setw(14) << "Frees" << std::setw(16) << "Live bytes" << std::setw(16) << "Peak live" << "\n";
+
+    for (int tag = 0; tag < NUMBER_OF_ALLOCATION_TAGS; tag++)
+    {
+        if (tag == OTHER_TAG)
+        {
+            output << std::string(100, '-') << "\n";
+        }
+
+        AllocationTagStats stats = getStats(static_cast<AllocationTag>(tag));
+        output << std::left << std::setw(24) << TAG_NAMES[tag] << std::right << std::setw(14) << stats.allocations << std::setw(16) << stats.bytesAllocated;
+        output << std::setw(14) << stats.frees << std::setw(16) << stats.liveBytes << std::setw(16) << stats.peakLiveBytes << "\n";
+    }
+}
+
+// Clear the allocation counts of every tag. Memory that is still live stays attributed to its tags, and the peaks restart from it.
+void AllocationTracker::reset()
+{
+    for (int tag = 0; tag < NUMBER_OF_ALLOCATION_TAGS; tag++)
+    {
+        tagAllocations[tag] = 0;
+        tagBytes[tag] = 0;
+        tagFrees[tag] = 0;
+        tagPeakLiveBytes[tag] = tagLiveBytes[tag].load();
+    }
+    peakLiveBytes = liveBytes.load();
+}
+
+// Make `tag` the current phase or subsystem of the calling thread and return the tag it replaces
+AllocationTag AllocationTracker::setCurrentTag(AllocationTag tag)
+{
+    AllocationTag &current = tag < OTHER_TAG ? currentPhase : currentSubsystem;
+    AllocationTag previous = current;
+    current = tag;
+    return previous;
+}
+
+
+/*
+===================================
+ Implementation for ScopedAllocationTag class
+===================================
+ */
+
+// Constructor
+ScopedAllocationTag::ScopedAllocationTag(AllocationTag tag) : previousTag_(AllocationTracker::setCurrentTag(tag)) {}
+
+// Destructor
+ScopedAllocationTag::~ScopedAllocationTag()
+{
+    AllocationTracker::setCurrentTag(previousTag_);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// Tags that heap allocations are attributed to. Every tracked allocation has one engine phase and one subsystem:
+// the innermost enclosing scope of each kind, or NO_PHASE_TAG / OTHER_TAG outside of any scope.
+enum AllocationTag : uint8_t
+{
+    // Engine phases
+    NO_PHASE_TAG,
+    STARTUP_TAG,
+    REINFORCEMENT_TAG,
+    ISSUE_ORDERS_TAG,
+    EXECUTE_ORDERS_TAG,
+    // Subsystems
+    OTHER_TAG,
+    MAP_LOADING_TAG,
+    STRATEGY_TAG,
+    ORDERS_TAG,
+    CARDS_TAG,
+    OBSERVERS_TAG,
+    NUMBER_OF_ALLOCATION_TAGS
+};
+
+// Attribute the heap allocations made in a scope to `tag` (and to the enclosing scope of the other kind).
+// Tagging is compiled in with the `WARZONE_PROFILING` CMake option. Without it, this macro expands to nothing.
+#ifdef WARZONE_PROFILING
+#define WARZONE_ALLOCATION_CONCAT_(a, b) a##b
+#define WARZONE_ALLOCATION_CONCAT(a, b) WARZONE_ALLOCATION_CONCAT_(a, b)
+#define ALLOCATION_SCOPE(tag) ScopedAllocationTag WARZONE_ALLOCATION_CONCAT(allocationTag, __LINE__)(tag)
+#else
+#define ALLOCATION_SCOPE(tag) do {} while (false)
+#endif
+
+
+// Heap usage attributed to a tag. Live bytes are only known for allocations made while tracking was enabled.
+struct AllocationTagStats
+{
+    uint64_t allocations;
+    uint64_t bytesAllocated;
+    uint64_t frees;
+    int64_t liveBytes;
+    int64_t peakLiveBytes;
+};
+
+
+// Counts every heap allocation made through the global operator new and, once enabled, attributes them to tags.
+// The replacement allocation functions live in AllocationTracker.cpp, so they are only linked into programs that use this class.
+// They prefix every block with a small header holding its size and tags, which is how frees are attributed.
+class AllocationTracker
+{
+public:
+    static uint64_t getAllocationCount();
+    static uint64_t getBytesAllocated();
+    static bool isEnabled();
+    static void setEnabled(bool enabled);
+    static int64_t getLiveBytes();
+    static int64_t getPeakLiveBytes();
+    static AllocationTagStats getStats(AllocationTag tag);
+    static std::string getTagName(AllocationTag tag);
+    static std::string getReport();
+    static void report(std::ostream &output);
+    static void reset();
+    static AllocationTag setCurrentTag(AllocationTag tag);
+};
+
+
+// Attributes the allocations of the enclosing scope to a tag, restoring the previous tag of the same kind when it goes out of scope.
+class ScopedAllocationTag
+{
+public:
+    ScopedAllocationTag(AllocationTag tag);
+    ScopedAllocationTag(const ScopedAllocationTag &scope) = delete;
+    ~ScopedAllocationTag();
+    const ScopedAllocationTag &operator=(const ScopedAllocationTag &scope) = delete;
+
+private:
+    AllocationTag previousTag_;
+};
@@ -0,0 +1,169 @@
+#include "PerfCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace
+{
+#ifdef __linux__
+    const int NUMBER_OF_EVENTS = 4;
+    const uint64_t EVENTS[NUMBER_OF_EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    // The counters of one thread, opened as a single group so that they are read together.
+    // Events that the CPU (or virtual machine) does not support are left out of the group.
+    struct CounterGroup
+    {
+        int leader = -1;
+        int fileDescriptors[NUMBER_OF_EVENTS] = { -1, -1, -1, -1 };
+        int numberOfOpenEvents = 0;
+        int positions[NUMBER_OF_EVENTS] = { -1, -1, -1, -1 };
+
+        CounterGroup()
+        {
+            for (int event = 0; event < NUMBER_OF_EVENTS; event++)
+            {
+                perf_event_attr attributes;
+                memset(&attributes, 0, sizeof(attributes));
+                attributes.size = sizeof(attributes);
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.config = EVENTS[event];
+                attributes.read_format = PERF_FORMAT_GROUP;
+                attributes.exclude_kernel = 1;
+                attributes.exclude_hv = 1;
+
+                int fileDescriptor = syscall(__NR_perf_event_open, &attributes, 0, -1, leader, 0);
+                if (fileDescriptor < 0)
+                {
+                    // Without the cycles counter there is no group to join
+                    if (leader == -1)
+                    {
+                        return;
+                    }
+                    continue;
+                }
+
+                if (leader == -1)
+                {
+                    leader = fileDescriptor;
+                }
+                fileDescriptors[event] = fileDescriptor;
+                positions[event] = numberOfOpenEvents++;
+            }
+        }
+
+        ~CounterGroup()
+        {
+            for (const auto &fileDescriptor : fileDescriptors)
+            {
+                if (fileDescriptor != -1)
+                {
+                    close(fileDescriptor);
+                }
+            }
+        }
+
+        bool isOpen() const
+        {
+            return leader != -1;
+        }
+
+        PerfCounterValues read() const
+        {
+            PerfCounterValues values = { 0, 0, 0, 0 };
+            if (!isOpen())
+            {
+                return values;
+            }
+
+            // Layout of a group read: the number of events, then one value per event in the order they were opened
+            uint64_t buffer[1 + NUMBER_OF_EVENTS];
+            if (::read(leader, buffer, sizeof(buffer)) <= 0)
+            {
+                return values;
+            }
+
+            uint64_t* results[NUMBER_OF_EVENTS] = { &values.cycles, &values.instructions, &values.cacheMisses, &values.branchMisses };
+            for (int event = 0; event < NUMBER_OF_EVENTS; event++)
+            {
+                if (positions[event] != -1)
+                {
+                    *results[event] = buffer[1 + positions[event]];
+                }
+            }
+
+            return values;
+        }
+    };
+
+    CounterGroup &getCounterGroup()
+    {
+        thread_local CounterGroup group;
+        return group;
+    }
+#endif
+}
+
+
+PerfCounterValues operator-(const PerfCounterValues &end, const PerfCounterValues &start)
+{
+    return { end.cycles - start.cycles, end.instructions - start.instructions, end.cacheMisses - start.cacheMisses, end.branchMisses - start.branchMisses };
+}
+
+std::ostream &operator<<(std::ostream &output, const PerfCounterValues &values)
+{
+    output << "[PerfCounters] " << values.cycles << " cycles, " << values.instructions << " instructions, ";
+    output << values.cacheMisses << " cache misses, " << values.branchMisses << " branch misses";
+    return output;
+}
+
+
+// Initialize static members
+std::atomic<bool> PerfCounters::enabled_(false);
+
+
+/*
+===================================
+ Implementation for PerfCounters class
+===================================
+ */
+
+// Whether the hardware counters can be read on this thread
+bool PerfCounters::isSupported()
+{
+#ifdef __linux__
+    return getCounterGroup().isOpen();
+#else
+    return false;
+#endif
+}
+
+bool PerfCounters::isEnabled()
+{
+    return enabled_.load(std::memory_order_relaxed);
+}
+
+void PerfCounters::setEnabled(bool enabled)
+{
+    enabled_ = enabled;
+}
+
+// Read the counters of the calling thread. All zeros if counting is disabled or unsupported.
+PerfCounterValues PerfCounters::read()
+{
+#ifdef __linux__
+    if (isEnabled())
+    {
+        return getCounterGroup().read();
+    }
+#endif
+    return { 0, 0, 0, 0 };
+}
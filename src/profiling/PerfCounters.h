@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+// Hardware counter readings. Counters that could not be opened stay at 0.
+struct PerfCounterValues
+{
+    uint64_t cycles;
+    uint64_t instructions;
+    uint64_t cacheMisses;
+    uint64_t branchMisses;
+};
+
+PerfCounterValues operator-(const PerfCounterValues &end, const PerfCounterValues &start);
+std::ostream &operator<<(std::ostream &output, const PerfCounterValues &values);
+
+
+// Cycles, instructions, cache misses and branch misses of the calling thread, read through `perf_event_open` on Linux.
+// Counting is off until enabled; each thread opens its own counters the first time it reads them.
+// On other platforms, or when the kernel refuses access (see /proc/sys/kernel/perf_event_paranoid), every reading is 0.
+class PerfCounters
+{
+public:
+    static bool isSupported();
+    static bool isEnabled();
+    static void setEnabled(bool enabled);
+    static PerfCounterValues read();
+
+private:
+    static std::atomic<bool> enabled_;
+};
@@ -0,0 +1,225 @@
+#include "Profiler.h"
+#include "AllocationTracker.h"
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+    const std::string SECTION_NAMES[NUMBER_OF_SECTIONS] = {
+        "Reinforcement phase",
+        "Issue orders phase",
+        "Execute orders phase",
+        "Strategy issueOrder",
+        "Order execution",
+        "Observers"
+    };
+
+    const std::string ORDER_TYPE_NAMES[] = { "Deploy", "Advance", "Bomb", "Blockade", "Airlift", "Negotiate" };
+
+    // Raise `maximum` to `value` if it is larger
+    void updateMaximum(std::atomic<uint64_t> &maximum, uint64_t value)
+    {
+        uint64_t current = maximum.load(std::memory_order_relaxed);
+        while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+}
+
+
+// Initialize static members
+std::atomic<uint64_t> Profiler::calls_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::totalNanoseconds_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::maximumNanoseconds_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::allocations_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::bytesAllocated_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::cycles_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::instructions_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::cacheMisses_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::branchMisses_[NUMBER_OF_SECTIONS];
+std::atomic<uint64_t> Profiler::counters_[NUMBER_OF_COUNTERS];
+std::atomic<uint64_t> Profiler::orderCounters_[NUMBER_OF_COUNTERS][NUMBER_OF_ORDER_TYPES];
+
+
+/*
+===================================
+ Implementation for Profiler class
+===================================
+ */
+
+// Whether profiling was compiled in
+bool Profiler::isEnabled()
+{
+#ifdef WARZONE_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Getters
+ProfileSectionStats Profiler::getSection(ProfileSection section)
+{
+    ProfileSectionStats stats;
+    stats.calls = calls_[section].load(std::memory_order_relaxed);
+    stats.totalNanoseconds = totalNanoseconds_[section].load(std::memory_order_relaxed);
+    stats.maximumNanoseconds = maximumNanoseconds_[section].load(std::memory_order_relaxed);
+    stats.allocations = allocations_[section].load(std::memory_order_relaxed);
+    stats.bytesAllocated = bytesAllocated_[section].load(std::memory_order_relaxed);
+    stats.hardware.cycles = cycles_[section].load(std::memory_order_relaxed);
+    stats.hardware.instructions = instructions_[section].load(std::memory_order_relaxed);
+    stats.hardware.cacheMisses = cacheMisses_[section].load(std::memory_order_relaxed);
+    stats.hardware.branchMisses = branchMisses_[section].load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint64_t Profiler::getCount(ProfileCounter counter)
+{
+    return counters_[counter].load(std::memory_order_relaxed);
+}
+
+uint64_t Profiler::getOrderCount(ProfileCounter counter, OrderType type)
+{
+    return orderCounters_[counter][type].load(std::memory_order_relaxed);
+}
+
+// Build the report of everything measured since the last reset
+std::string Profiler::getReport()
+{
+    std::ostringstream output;
+    report(output);
+    return output.str();
+}
+
+void Profiler::report(std::ostream &output)
+{
+    output << "\n===== Profile: " << getCount(ROUNDS_COUNTER) << " rounds =====\n";
+    output << std::left << std::setw(24) << "Section" << std::right << std::setw(10) << "Calls" << std::setw(14) << "Total (ms)";
+    output << std::setw(12) << "Avg (us)" << std::setw(12) << "Max (us)" << std::setw(14) << "Allocations" << std::setw(14) << "Bytes" << "\n";
+
+    output << std::fixed << std::setprecision(2);
+    for (int section = 0; section < NUMBER_OF_SECTIONS; section++)
+    {
+        ProfileSectionStats stats = getSection(static_cast<ProfileSection>(section));
+        double averageMicroseconds = stats.calls == 0 ? 0 : stats.totalNanoseconds / 1000.0 / stats.calls;
+        output << std::left << std::setw(24) << SECTION_NAMES[section] << std::right << std::setw(10) << stats.calls;
+        output << std::setw(14) << stats.totalNanoseconds / 1000000.0 << std::setw(12) << averageMicroseconds;
+        output << std::setw(12) << stats.maximumNanoseconds / 1000.0 << std::setw(14) << stats.allocations << std::setw(14) << stats.bytesAllocated << "\n";
+    }
+
+    if (PerfCounters::isEnabled())
+    {
+        output << "\n" << std::left << std::setw(24) << "Section" << std::right << std::setw(14) << "Total (ms)" << std::setw(16) << "Cycles (M)";
+        output << std::setw(16) << "Instr. (M)" << std::setw(8) << "IPC" << std::setw(16) << "Cache misses" << std::setw(16) << "Branch misses" << "\n";
+        for (int section = 0; section < NUMBER_OF_SECTIONS; section++)
+        {
+            ProfileSectionStats stats = getSection(static_cast<ProfileSection>(section));
+            double instructionsPerCycle = stats.hardware.cycles == 0 ? 0 : static_cast<double>(stats.hardware.instructions) / stats.hardware.cycles;
+            output << std::left << std::setw(24) << SECTION_NAMES[section] << std::right << std::setw(14) << stats.totalNanoseconds / 1000000.0;
+            output << std::setw(16) << stats.hardware.cycles / 1000000.0 << std::setw(16) << stats.hardware.instructions / 1000000.0;
+            output << std::setw(8) << instructionsPerCycle << std::setw(16) << stats.hardware.cacheMisses << std::setw(16) << stats.hardware.branchMisses << "\n";
+        }
+    }
+
+    output << "\n" << std::left << std::setw(24) << "Orders" << std::right << std::setw(10) << "Issued" << std::setw(14) << "Executed" << std::setw(12) << "Invalid" << "\n";
+    for (int type = 0; type < NUMBER_OF_ORDER_TYPES; type++)
+    {
+        OrderType orderType = static_cast<OrderType>(type);
+        output << std::left << std::setw(24) << ORDER_TYPE_NAMES[type] << std::right;
+        output << std::setw(10) << getOrderCount(ORDERS_ISSUED_COUNTER, orderType);
+        output << std::setw(14) << getOrderCount(ORDERS_EXECUTED_COUNTER, orderType);
+        output << std::setw(12) << getOrderCount(ORDERS_INVALIDATED_COUNTER, orderType) << "\n";
+    }
+    output << std::left << std::setw(24) << "Total" << std::right << std::setw(10) << getCount(ORDERS_ISSUED_COUNTER);
+    output << std::setw(14) << getCount(ORDERS_EXECUTED_COUNTER) << std::setw(12) << getCount(ORDERS_INVALIDATED_COUNTER) << "\n";
+
+    output << "\ngetOwnerOf calls: " << getCount(GET_OWNER_OF_COUNTER) << "\n";
+    output.unsetf(std::ios::floatfield);
+    output << std::setprecision(6);
+
+    if (AllocationTracker::isEnabled())
+    {
+        AllocationTracker::report(output);
+    }
+}
+
+// Clear everything measured so far. Called at the start of every game.
+void Profiler::reset()
+{
+    for (int section = 0; section < NUMBER_OF_SECTIONS; section++)
+    {
+        calls_[section] = 0;
+        totalNanoseconds_[section] = 0;
+        maximumNanoseconds_[section] = 0;
+        allocations_[section] = 0;
+        bytesAllocated_[section] = 0;
+        cycles_[section] = 0;
+        instructions_[section] = 0;
+        cacheMisses_[section] = 0;
+        branchMisses_[section] = 0;
+    }
+
+    for (int counter = 0; counter < NUMBER_OF_COUNTERS; counter++)
+    {
+        counters_[counter] = 0;
+        for (int type = 0; type < NUMBER_OF_ORDER_TYPES; type++)
+        {
+            orderCounters_[counter][type] = 0;
+        }
+    }
+
+    AllocationTracker::reset();
+}
+
+// Add a timed call to a section
+void Profiler::record(ProfileSection section, uint64_t nanoseconds, uint64_t allocations, uint64_t bytesAllocated, const PerfCounterValues &hardware)
+{
+    calls_[section].fetch_add(1, std::memory_order_relaxed);
+    totalNanoseconds_[section].fetch_add(nanoseconds, std::memory_order_relaxed);
+    allocations_[section].fetch_add(allocations, std::memory_order_relaxed);
+    bytesAllocated_[section].fetch_add(bytesAllocated, std::memory_order_relaxed);
+    updateMaximum(maximumNanoseconds_[section], nanoseconds);
+
+    if (hardware.cycles != 0)
+    {
+        cycles_[section].fetch_add(hardware.cycles, std::memory_order_relaxed);
+        instructions_[section].fetch_add(hardware.instructions, std::memory_order_relaxed);
+        cacheMisses_[section].fetch_add(hardware.cacheMisses, std::memory_order_relaxed);
+        branchMisses_[section].fetch_add(hardware.branchMisses, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::increment(ProfileCounter counter)
+{
+    counters_[counter].fetch_add(1, std::memory_order_relaxed);
+}
+
+// Count an order event both in total and for the type of the order
+void Profiler::incrementOrder(ProfileCounter counter, OrderType type)
+{
+    counters_[counter].fetch_add(1, std::memory_order_relaxed);
+    orderCounters_[counter][type].fetch_add(1, std::memory_order_relaxed);
+}
+
+
+/*
+===================================
+ Implementation for ScopedTimer class
+===================================
+ */
+
+// Constructor
+ScopedTimer::ScopedTimer(ProfileSection section)
+    : section_(section),
+      allocationsAtStart_(AllocationTracker::getAllocationCount()),
+      bytesAtStart_(AllocationTracker::getBytesAllocated()),
+      hardwareAtStart_(PerfCounters::read()),
+      start_(std::chrono::steady_clock::now()) {}
+
+// Destructor
+ScopedTimer::~ScopedTimer()
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+    PerfCounterValues hardware = PerfCounters::read() - hardwareAtStart_;
+    uint64_t allocations = AllocationTracker::getAllocationCount() - allocationsAtStart_;
+    uint64_t bytesAllocated = AllocationTracker::getBytesAllocated() - bytesAtStart_;
+    Profiler::record(section_, elapsed.count(), allocations, bytesAllocated, hardware);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "../logging/Logger.h"
+#include "../orders/Orders.h"
+#include "PerfCounters.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// Sections of the game that are timed
+enum ProfileSection : short
+{
+    REINFORCEMENT_SECTION,
+    ISSUE_ORDERS_SECTION,
+    EXECUTE_ORDERS_SECTION,
+    STRATEGY_SECTION,
+    ORDER_EXECUTION_SECTION,
+    OBSERVERS_SECTION,
+    NUMBER_OF_SECTIONS
+};
+
+// Events that are counted. Order events are also counted per order type.
+enum ProfileCounter : short
+{
+    ROUNDS_COUNTER,
+    ORDERS_ISSUED_COUNTER,
+    ORDERS_EXECUTED_COUNTER,
+    ORDERS_INVALIDATED_COUNTER,
+    GET_OWNER_OF_COUNTER,
+    NUMBER_OF_COUNTERS
+};
+
+// Profiling is compiled in with the `WARZONE_PROFILING` CMake option. Without it, these macros expand to nothing.
+#ifdef WARZONE_PROFILING
+#define WARZONE_PROFILE_CONCAT_(a, b) a##b
+#define WARZONE_PROFILE_CONCAT(a, b) WARZONE_PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(section) ScopedTimer WARZONE_PROFILE_CONCAT(scopedTimer, __LINE__)(section)
+#define PROFILE_COUNT(counter) Profiler::increment(counter)
+#define PROFILE_COUNT_ORDER(counter, order) Profiler::incrementOrder(counter, (order)->getType())
+#define PROFILE_RESET() Profiler::reset()
+#define PROFILE_REPORT() LOG_INFO(Profiler::getReport())
+#else
+#define PROFILE_SCOPE(section) do {} while (false)
+#define PROFILE_COUNT(counter) do {} while (false)
+#define PROFILE_COUNT_ORDER(counter, order) do {} while (false)
+#define PROFILE_RESET() do {} while (false)
+#define PROFILE_REPORT() do {} while (false)
+#endif
+
+
+// Accumulated statistics of a section. Allocations and hardware counts of nested sections are included.
+// The hardware counts stay at 0 unless PerfCounters are enabled.
+struct ProfileSectionStats
+{
+    uint64_t calls;
+    uint64_t totalNanoseconds;
+    uint64_t maximumNanoseconds;
+    uint64_t allocations;
+    uint64_t bytesAllocated;
+    PerfCounterValues hardware;
+};
+
+
+class Profiler
+{
+public:
+    static bool isEnabled();
+    static ProfileSectionStats getSection(ProfileSection section);
+    static uint64_t getCount(ProfileCounter counter);
+    static uint64_t getOrderCount(ProfileCounter counter, OrderType type);
+    static std::string getReport();
+    static void report(std::ostream &output);
+    static void reset();
+    static void record(ProfileSection section, uint64_t nanoseconds, uint64_t allocations, uint64_t bytesAllocated, const PerfCounterValues &hardware);
+    static void increment(ProfileCounter counter);
+    static void incrementOrder(ProfileCounter counter, OrderType type);
+
+private:
+    static constexpr int NUMBER_OF_ORDER_TYPES = 6;
+    static std::atomic<uint64_t> calls_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> totalNanoseconds_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> maximumNanoseconds_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> allocations_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> bytesAllocated_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> cycles_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> instructions_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> cacheMisses_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> branchMisses_[NUMBER_OF_SECTIONS];
+    static std::atomic<uint64_t> counters_[NUMBER_OF_COUNTERS];
+    static std::atomic<uint64_t> orderCounters_[NUMBER_OF_COUNTERS][NUMBER_OF_ORDER_TYPES];
+};
+
+
+// Times the enclosing scope and adds it to a section of the Profiler when it goes out of scope.
+class ScopedTimer
+{
+public:
+    ScopedTimer(ProfileSection section);
+    ScopedTimer(const ScopedTimer &timer) = delete;
+    ~ScopedTimer();
+    const ScopedTimer &operator=(const ScopedTimer &timer) = delete;
+
+private:
+    ProfileSection section_;
+    uint64_t allocationsAtStart_;
+    uint64_t bytesAtStart_;
+    PerfCounterValues hardwareAtStart_;
+    std::chrono::steady_clock::time_point start_;
+};
@@ -0,0 +1,109 @@
+#include "Profiler.h"
+#include "AllocationTracker.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapLoader.h"
+#include <sstream>
+
+int main(int argc, char* argv[])
+{
+    // Usage: ProfilerDriver [--perf] [--track-allocations]
+    if (!Profiler::isEnabled())
+    {
+        std::cout << "Profiling is compiled out. Reconfigure with -DWARZONE_PROFILING=ON to collect timings and counters." << std::endl;
+    }
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string option = argv[i];
+
+        // Optionally attribute hardware counters to the profiled sections as well
+        if (option == "--perf")
+        {
+            PerfCounters::setEnabled(true);
+            if (!PerfCounters::isSupported())
+            {
+                std::cout << "Hardware counters are unavailable on this system (see /proc/sys/kernel/perf_event_paranoid)." << std::endl;
+            }
+        }
+        // Optionally attribute the heap allocations to engine phases and subsystems
+        else if (option == "--track-allocations")
+        {
+            AllocationTracker::setEnabled(true);
+        }
+        else
+        {
+            std::cout << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+
+    // Setup
+    GameEngine gameEngine;
+    MapLoader loader;
+
+    gameEngine.setMap(loader.loadMap("resources/canada.map"));
+    gameEngine.setPlayers({
+        new Player("Aggressive", new AggressivePlayerStrategy()),
+        new Player("Benevolent", new BenevolentPlayerStrategy()),
+        new Player("Aggressive 2", new AggressivePlayerStrategy())
+    });
+    GameEngine::getDeck()->generateCards(50);
+    GameEngine::setSeed(42);
+
+    // Attach the observers so that their cost shows up in the profile, but keep their output off the console
+    PhaseObserver* phaseObserver = new PhaseObserver(&gameEngine);
+    GameStatisticsObserver* statisticsObserver = new GameStatisticsObserver(&gameEngine);
+    gameEngine.attach(phaseObserver);
+    gameEngine.attach(statisticsObserver);
+    std::ostringstream observerOutput;
+    std::streambuf* console = std::cout.rdbuf(observerOutput.rdbuf());
+    Logger::setLevel(OFF_LEVEL);
+
+    // Play up to 30 rounds
+    gameEngine.startupPhase();
+    const int NUMBER_OF_ROUNDS = 30;
+    while (gameEngine.getRound() < NUMBER_OF_ROUNDS && gameEngine.playRound()) {}
+
+    std::cout.rdbuf(console);
+    Logger::setLevel(INFO_LEVEL);
+
+    // End-of-game report
+    PROFILE_REPORT();
+
+    // The same numbers are available through the query API
+    ProfileSectionStats issuing = Profiler::getSection(ISSUE_ORDERS_SECTION);
+    ProfileSectionStats strategies = Profiler::getSection(STRATEGY_SECTION);
+    if (issuing.totalNanoseconds > 0)
+    {
+        std::cout << "\nStrategies account for " << 100.0 * strategies.totalNanoseconds / issuing.totalNanoseconds << "% of the issue orders phase." << std::endl;
+    }
+    std::cout << "Deploy orders executed: " << Profiler::getOrderCount(ORDERS_EXECUTED_COUNTER, DEPLOY) << std::endl;
+
+    // Allocation budgets per round. A regression past one of them fails the run.
+    bool withinBudgets = true;
+    if (AllocationTracker::isEnabled() && Profiler::isEnabled() && gameEngine.getRound() > 0)
+    {
+        const std::vector<std::pair<AllocationTag, uint64_t>> ALLOCATIONS_PER_ROUND_BUDGETS = {
+            { REINFORCEMENT_TAG, 300 },
+            { ISSUE_ORDERS_TAG, 15000 },
+            { EXECUTE_ORDERS_TAG, 2500 },
+            { OBSERVERS_TAG, 4000 }
+        };
+
+        std::cout << "\nAllocation budgets (per round):" << std::endl;
+        for (const auto &budget : ALLOCATIONS_PER_ROUND_BUDGETS)
+        {
+            uint64_t allocationsPerRound = AllocationTracker::getStats(budget.first).allocations / gameEngine.getRound();
+            bool withinBudget = allocationsPerRound <= budget.second;
+            withinBudgets = withinBudgets && withinBudget;
+            std::cout << "  " << AllocationTracker::getTagName(budget.first) << ": " << allocationsPerRound << " / " << budget.second;
+            std::cout << (withinBudget ? "" : "  OVER BUDGET") << std::endl;
+        }
+    }
+
+    // Clean up dynamically allocated memory (the observers are deleted along with the game engine)
+    GameEngine::resetGameEngine();
+
+    return withinBudgets ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+#include "Tracer.h"
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+    // Number of spans a thread buffers before handing them to the Tracer
+    const size_t THREAD_BUFFER_SIZE = 4096;
+
+    std::atomic<uint32_t> nextThreadId(1);
+
+    // Per-thread buffer of completed spans. Whatever is left in the buffer is handed over when its thread exits.
+    struct ThreadBuffer
+    {
+        std::vector<TraceEvent> events;
+
+        ~ThreadBuffer()
+        {
+            Tracer::collect(events);
+        }
+    };
+
+    ThreadBuffer &getThreadBuffer()
+    {
+        thread_local ThreadBuffer buffer;
+        return buffer;
+    }
+
+    // Escape a string so that it can be written as a JSON string literal
+    std::string escapeJson(const std::string &text)
+    {
+        std::string escaped;
+        for (const auto &character : text)
+        {
+            if (character == '"' || character == '\\')
+            {
+                escaped += '\\';
+            }
+            escaped += character;
+        }
+
+        return escaped;
+    }
+}
+
+
+// Initialize static members
+std::atomic<bool> Tracer::active_(false);
+std::string Tracer::filename_;
+std::chrono::steady_clock::time_point Tracer::start_;
+std::mutex Tracer::eventsMutex_;
+std::vector<TraceEvent> Tracer::events_;
+
+
+/*
+===================================
+ Implementation for Tracer class
+===================================
+ */
+
+bool Tracer::isActive()
+{
+    return active_.load(std::memory_order_relaxed);
+}
+
+// Start recording spans. They are written to `filename` when the trace is stopped.
+void Tracer::start(std::string filename)
+{
+    std::lock_guard<std::mutex> lock(eventsMutex_);
+    events_.clear();
+    filename_ = filename;
+    start_ = std::chrono::steady_clock::now();
+    active_ = true;
+}
+
+// Stop recording and write the trace file
+void Tracer::stop()
+{
+    if (!isActive())
+    {
+        return;
+    }
+
+    std::vector<TraceEvent> &buffer = getThreadBuffer().events;
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(eventsMutex_);
+        events_.insert(events_.end(), buffer.begin(), buffer.end());
+        buffer.clear();
+        active_ = false;
+        events.swap(events_);
+    }
+    sort(events.begin(), events.end(), [](const auto &e1, const auto &e2) { return e1.start < e2.start; });
+
+    std::ofstream output(filename_);
+    if (!output.is_open())
+    {
+        throw "Unable to open trace file";
+    }
+
+    output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    output << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Warzone\"}}";
+    output.precision(3);
+    output << std::fixed;
+    for (const auto &event : events)
+    {
+        output << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\"";
+        output << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << ",\"pid\":1,\"tid\":" << event.threadId;
+        if (!event.detail.empty())
+        {
+            output << ",\"args\":{\"detail\":\"" << escapeJson(event.detail) << "\"}";
+        }
+        output << "}";
+    }
+    output << "\n]}\n";
+}
+
+// Number of spans handed to the Tracer so far (spans still buffered by running threads are not included)
+size_t Tracer::getNumberOfEvents()
+{
+    std::lock_guard<std::mutex> lock(eventsMutex_);
+    return events_.size();
+}
+
+// Small sequential id of the calling thread, used as the `tid` of its spans
+uint32_t Tracer::getThreadId()
+{
+    thread_local uint32_t threadId = nextThreadId.fetch_add(1);
+    return threadId;
+}
+
+// Microseconds since the trace started
+double Tracer::now()
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_).count();
+}
+
+// Buffer a completed span on the calling thread
+void Tracer::record(TraceEvent event)
+{
+    std::vector<TraceEvent> &buffer = getThreadBuffer().events;
+    buffer.push_back(event);
+    if (buffer.size() >= THREAD_BUFFER_SIZE)
+    {
+        collect(buffer);
+    }
+}
+
+// Move a buffer of spans into the trace
+void Tracer::collect(std::vector<TraceEvent> &events)
+{
+    if (events.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(eventsMutex_);
+    if (isActive())
+    {
+        events_.insert(events_.end(), events.begin(), events.end());
+    }
+    events.clear();
+}
+
+
+/*
+===================================
+ Implementation for ScopedTraceEvent class
+===================================
+ */
+
+// Constructor
+ScopedTraceEvent::ScopedTraceEvent(const char* name, const char* category)
+    : name_(name), category_(category), start_(Tracer::isActive() ? Tracer::now() : -1) {}
+
+// Destructor
+ScopedTraceEvent::~ScopedTraceEvent()
+{
+    if (start_ >= 0 && Tracer::isActive())
+    {
+        Tracer::record({ name_, category_, detail_, start_, Tracer::now() - start_, Tracer::getThreadId() });
+    }
+}
+
+// Attach extra information to the span (e.g. the player whose turn it is)
+void ScopedTraceEvent::setDetail(std::string detail)
+{
+    detail_ = detail;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Trace a scope as a span named `name` in `category` (both string literals).
+// The `_DETAIL` variant attaches a string that is only built while a trace is being recorded.
+// Tracing is compiled in with the `WARZONE_PROFILING` CMake option. Without it, these macros expand to nothing.
+#ifdef WARZONE_PROFILING
+#define WARZONE_TRACE_CONCAT_(a, b) a##b
+#define WARZONE_TRACE_CONCAT(a, b) WARZONE_TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name, category) ScopedTraceEvent WARZONE_TRACE_CONCAT(traceEvent, __LINE__)(name, category)
+#define TRACE_SCOPE_DETAIL(name, category, detail)                                      \
+    ScopedTraceEvent WARZONE_TRACE_CONCAT(traceEvent, __LINE__)(name, category);        \
+    if (Tracer::isActive())                                                             \
+    {                                                                                   \
+        WARZONE_TRACE_CONCAT(traceEvent, __LINE__).setDetail(detail);                   \
+    }
+#else
+#define TRACE_SCOPE(name, category) do {} while (false)
+#define TRACE_SCOPE_DETAIL(name, category, detail) do {} while (false)
+#endif
+
+
+// A completed span. Times are in microseconds since the trace started.
+struct TraceEvent
+{
+    const char* name;
+    const char* category;
+    std::string detail;
+    double start;
+    double duration;
+    uint32_t threadId;
+};
+
+
+// Records spans into per-thread buffers and writes them out in the Chrome trace event format,
+// which can be opened in chrome://tracing or https://ui.perfetto.dev.
+// Threads that recorded spans must have finished (or be idle) when the trace is stopped.
+class Tracer
+{
+public:
+    static bool isActive();
+    static void start(std::string filename);
+    static void stop();
+    static size_t getNumberOfEvents();
+    static uint32_t getThreadId();
+    static double now();
+    static void record(TraceEvent event);
+    static void collect(std::vector<TraceEvent> &events);
+
+private:
+    static std::atomic<bool> active_;
+    static std::string filename_;
+    static std::chrono::steady_clock::time_point start_;
+    static std::mutex eventsMutex_;
+    static std::vector<TraceEvent> events_;
+};
+
+
+// Records the enclosing scope as a span when it goes out of scope, if a trace is being recorded.
+class ScopedTraceEvent
+{
+public:
+    ScopedTraceEvent(const char* name, const char* category);
+    ScopedTraceEvent(const ScopedTraceEvent &event) = delete;
+    ~ScopedTraceEvent();
+    const ScopedTraceEvent &operator=(const ScopedTraceEvent &event) = delete;
+    void setDetail(std::string detail);
+
+private:
+    const char* name_;
+    const char* category_;
+    std::string detail_;
+    double start_;
+};
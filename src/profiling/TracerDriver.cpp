@@ -0,0 +1,54 @@
+#include "Tracer.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapLoader.h"
+#include <sstream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    // Usage: TracerDriver [rounds] [map] [trace file]
+    int maximumRounds = argc > 1 ? std::stoi(argv[1]) : 500;
+    std::string mapFile = argc > 2 ? argv[2] : "resources/canada.map";
+    std::string traceFile = argc > 3 ? argv[3] : "warzone_trace.json";
+
+#ifndef WARZONE_PROFILING
+    std::cout << "Tracing is compiled out. Reconfigure with -DWARZONE_PROFILING=ON to record spans." << std::endl;
+#endif
+
+    // Setup
+    GameEngine gameEngine;
+    MapLoader loader;
+
+    gameEngine.setMap(loader.loadMap(mapFile));
+    gameEngine.setPlayers({
+        new Player("Aggressive", new AggressivePlayerStrategy()),
+        new Player("Benevolent", new BenevolentPlayerStrategy()),
+        new Player("Benevolent 2", new BenevolentPlayerStrategy())
+    });
+    GameEngine::getDeck()->generateCards(50);
+    GameEngine::setSeed(42);
+    gameEngine.attach(new PhaseObserver(&gameEngine));
+
+    // Keep the game and observer output off the console
+    std::ostringstream observerOutput;
+    std::streambuf* console = std::cout.rdbuf(observerOutput.rdbuf());
+    Logger::setLevel(OFF_LEVEL);
+
+    // Play until the game is won or the round limit is reached
+    Tracer::start(traceFile);
+    gameEngine.startupPhase();
+    while (gameEngine.getRound() < maximumRounds && gameEngine.playRound()) {}
+    Tracer::stop();
+
+    std::cout.rdbuf(console);
+    Logger::setLevel(INFO_LEVEL);
+
+    std::cout << "Played " << gameEngine.getRound() << " rounds, trace written to " << traceFile << std::endl;
+    std::cout << "Open it in chrome://tracing or https://ui.perfetto.dev" << std::endl;
+
+    // Clean up dynamically allocated memory
+    GameEngine::resetGameEngine();
+
+    return 0;
+}
@@ -0,0 +1,353 @@
+#include "GameRecorder.h"
+#include <algorithm>
+
+namespace
+{
+    // Number of bytes buffered in memory before they are appended to the recording file.
+    const size_t BUFFER_CAPACITY = 64 * 1024;
+
+    // FNV-1a parameters used to fingerprint the game state at the end of each round.
+    const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    const uint64_t FNV_PRIME = 1099511628211ULL;
+
+    // Mix the bytes of `value` into an FNV-1a hash.
+    template <typename T>
+    uint64_t hashCombine(uint64_t hash, T value)
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    // Helper function to get the id of a territory, or `NO_TERRITORY` if there is none.
+    uint32_t getTerritoryId(Territory* territory)
+    {
+        return territory == nullptr ? GameRecorder::NO_TERRITORY : territory->getId();
+    }
+
+    // Helper function to extract the territories and number of armies referenced by an order.
+    // Orders acting on a single territory (bomb, blockade) report it as the destination.
+    void getOrderArguments(const Order* order, Territory* &source, Territory* &destination, int &armies)
+    {
+        source = nullptr;
+        destination = nullptr;
+        armies = 0;
+
+        switch (order->getType())
+        {
+            case DEPLOY:
+            {
+                const DeployOrder* deploy = static_cast<const DeployOrder*>(order);
+                destination = deploy->getDestination();
+                armies = deploy->getNumberOfArmies();
+                break;
+            }
+            case ADVANCE:
+            {
+                const AdvanceOrder* advance = static_cast<const AdvanceOrder*>(order);
+                source = advance->getSource();
+                destination = advance->getDestination();
+                armies = advance->getNumberOfArmies();
+                break;
+            }
+            case BOMB:
+                destination = static_cast<const BombOrder*>(order)->getTarget();
+                break;
+            case BLOCKADE:
+                destination = static_cast<const BlockadeOrder*>(order)->getTerritory();
+                break;
+            case AIRLIFT:
+            {
+                const AirliftOrder* airlift = static_cast<const AirliftOrder*>(order);
+                source = airlift->getSource();
+                destination = airlift->getDestination();
+                armies = airlift->getNumberOfArmies();
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+
+/* 
+===================================
+ Implementation for GameRecorder class
+===================================
+ */
+
+// Constructor
+GameRecorder::GameRecorder(std::string filename)
+    : filename_(filename),
+      output_(filename, std::ios::binary | std::ios::trunc),
+      bytesWritten_(0),
+      round_(0),
+      nextPlayerId_(0),
+      sourceArmiesBefore_(0),
+      destinationArmiesBefore_(0)
+{
+    if (!output_.is_open())
+    {
+        throw "Unable to open recording file";
+    }
+
+    buffer_.reserve(BUFFER_CAPACITY);
+    write_(MAGIC);
+    write_(VERSION);
+}
+
+// Destructor
+GameRecorder::~GameRecorder()
+{
+    flush();
+    output_.close();
+}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const GameRecorder &recorder)
+{
+    output << "[GameRecorder] " << recorder.filename_ << ", " << recorder.getBytesWritten() << " bytes, " << recorder.round_ << " rounds recorded";
+    return output;
+}
+
+// Getters
+uint32_t GameRecorder::getRound() const
+{
+    return round_;
+}
+
+uint64_t GameRecorder::getBytesWritten() const
+{
+    return bytesWritten_ + buffer_.size();
+}
+
+// Compute a fingerprint of the current game state
+uint64_t GameRecorder::hashState() const
+{
+    return hashState(territories_, playerIds_);
+}
+
+// Compute a fingerprint of a game state from the owner and number of armies of every territory.
+// `territories` must be sorted by id and `playerIds` maps each player still in the game to its recorded id.
+uint64_t GameRecorder::hashState(const std::vector<Territory*> &territories, const std::unordered_map<Player*, uint16_t> &playerIds)
+{
+    std::vector<uint16_t> owners(territories.size(), NO_PLAYER);
+    for (const auto &entry : playerIds)
+    {
+        for (const auto &territory : entry.first->getOwnedTerritories())
+        {
+            owners.at(territory->getId()) = entry.second;
+        }
+    }
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < territories.size(); i++)
+    {
+        hash = hashCombine(hash, owners.at(i));
+        hash = hashCombine(hash, territories.at(i)->getNumberOfArmies());
+    }
+
+    return hash;
+}
+
+// Record the RNG seed and the map, and register the players in their turn order.
+void GameRecorder::recordGameStart(unsigned int seed, Map* map, std::vector<Player*> players)
+{
+    territories_ = map->getTerritories();
+    sort(territories_.begin(), territories_.end(), [](auto t1, auto t2) { return t1->getId() < t2->getId(); });
+
+    write_(GAME_STARTED);
+    write_(static_cast<uint32_t>(seed));
+    write_(static_cast<uint32_t>(territories_.size()));
+    endEvent_();
+
+    for (const auto &player : players)
+    {
+        getPlayerId_(player);
+    }
+}
+
+// Mark the start of a new round
+void GameRecorder::recordRoundStart()
+{
+    write_(ROUND_STARTED);
+    write_(++round_);
+    endEvent_();
+}
+
+// Mark the start of a game phase
+void GameRecorder::recordPhase(Phase phase)
+{
+    write_(PHASE_STARTED);
+    write_(static_cast<uint8_t>(phase));
+    endEvent_();
+}
+
+// Record an order as it is placed in a player's list of orders
+void GameRecorder::recordOrderIssued(const Order* order)
+{
+    writeOrder_(ORDER_ISSUED, order);
+    endEvent_();
+}
+
+// Take note of the number of armies on the territories touched by the order before it is executed.
+void GameRecorder::beginOrderExecution(const Order* order)
+{
+    Territory* source;
+    Territory* destination;
+    int armies;
+    getOrderArguments(order, source, destination, armies);
+
+    sourceArmiesBefore_ = source == nullptr ? 0 : source->getNumberOfArmies();
+    destinationArmiesBefore_ = destination == nullptr ? 0 : destination->getNumberOfArmies();
+}
+
+// Record an executed order along with whether it was valid and the change in armies it caused.
+void GameRecorder::recordOrderExecuted(const Order* order, bool valid)
+{
+    Territory* source;
+    Territory* destination;
+    int armies;
+    getOrderArguments(order, source, destination, armies);
+
+    writeOrder_(ORDER_EXECUTED, order);
+    write_(static_cast<uint8_t>(valid));
+    write_(static_cast<int32_t>(source == nullptr ? 0 : source->getNumberOfArmies() - sourceArmiesBefore_));
+    write_(static_cast<int32_t>(destination == nullptr ? 0 : destination->getNumberOfArmies() - destinationArmiesBefore_));
+    endEvent_();
+}
+
+// Record a territory being given to a new owner (initial distribution, conquest or blockade)
+void GameRecorder::recordOwnershipChange(Territory* territory, Player* newOwner)
+{
+    uint16_t ownerId = getPlayerId_(newOwner);
+
+    write_(TERRITORY_CAPTURED);
+    write_(getTerritoryId(territory));
+    write_(ownerId);
+    endEvent_();
+}
+
+// Record a card drawn from the deck
+void GameRecorder::recordCardDrawn(Player* player, const Card* card)
+{
+    uint16_t playerId = getPlayerId_(player);
+
+    write_(CARD_DRAWN);
+    write_(playerId);
+    write_(static_cast<uint8_t>(card->getType()));
+    endEvent_();
+}
+
+// Record a player running out of orders to execute for the current turn
+void GameRecorder::recordTurnEnd(Player* player)
+{
+    uint16_t playerId = getPlayerId_(player);
+
+    write_(TURN_ENDED);
+    write_(playerId);
+    endEvent_();
+}
+
+// Record a player being removed from the game. Its id is never reused.
+void GameRecorder::recordPlayerEliminated(Player* player)
+{
+    uint16_t playerId = getPlayerId_(player);
+    playerIds_.erase(player);
+
+    write_(PLAYER_ELIMINATED);
+    write_(playerId);
+    endEvent_();
+}
+
+// Mark the end of the current round along with a fingerprint of the resulting game state
+void GameRecorder::recordRoundEnd()
+{
+    write_(ROUND_ENDED);
+    write_(round_);
+    write_(hashState());
+    endEvent_();
+}
+
+// Mark the end of the game and write any buffered events to the file
+void GameRecorder::recordGameEnd()
+{
+    write_(GAME_ENDED);
+    write_(round_);
+    flush();
+}
+
+// Append the buffered events to the recording file
+void GameRecorder::flush()
+{
+    if (!buffer_.empty())
+    {
+        output_.write(buffer_.data(), buffer_.size());
+        bytesWritten_ += buffer_.size();
+        buffer_.clear();
+    }
+    output_.flush();
+}
+
+// Get the id of a player, registering it (and recording that it joined) the first time it is seen.
+uint16_t GameRecorder::getPlayerId_(Player* player)
+{
+    if (player == nullptr)
+    {
+        return NO_PLAYER;
+    }
+
+    auto iterator = playerIds_.find(player);
+    if (iterator != playerIds_.end())
+    {
+        return iterator->second;
+    }
+
+    uint16_t playerId = nextPlayerId_++;
+    playerIds_[player] = playerId;
+
+    std::string name = player->getName();
+    write_(PLAYER_JOINED);
+    write_(playerId);
+    write_(static_cast<uint8_t>(player->isNeutral()));
+    write_(static_cast<uint16_t>(name.size()));
+    buffer_.insert(buffer_.end(), name.begin(), name.end());
+    endEvent_();
+
+    return playerId;
+}
+
+// Helper method to write the type, issuer and arguments shared by the ORDER_ISSUED and ORDER_EXECUTED events.
+void GameRecorder::writeOrder_(RecordedEvent event, const Order* order)
+{
+    Territory* source;
+    Territory* destination;
+    int armies;
+    getOrderArguments(order, source, destination, armies);
+
+    Player* targetPlayer = order->getType() == NEGOTIATE ? static_cast<const NegotiateOrder*>(order)->getTarget() : nullptr;
+    uint16_t issuerId = getPlayerId_(order->getIssuer());
+    uint16_t targetId = getPlayerId_(targetPlayer);
+
+    write_(event);
+    write_(static_cast<uint8_t>(order->getType()));
+    write_(issuerId);
+    write_(targetId);
+    write_(static_cast<int32_t>(armies));
+    write_(getTerritoryId(source));
+    write_(getTerritoryId(destination));
+}
+
+// Helper method called after each event is written. Appends the buffer to the file once it is full.
+void GameRecorder::endEvent_()
+{
+    if (buffer_.size() >= BUFFER_CAPACITY)
+    {
+        flush();
+    }
+}
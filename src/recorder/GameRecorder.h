@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../cards/Cards.h"
+#include "../map/Map.h"
+#include "../observers/GameObservers.h"
+#include "../orders/Orders.h"
+#include "../player/Player.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Card;
+class Map;
+class Order;
+class Player;
+class Territory;
+
+// Tags identifying each event in a recorded game stream.
+// A recording starts with the magic number and format version, followed by events written as a 1-byte tag and
+// fixed-width fields in native byte order:
+// - GAME_STARTED:       u32 seed, u32 number of territories
+// - PLAYER_JOINED:      u16 player, u8 neutral, u16 name length, name bytes
+// - ROUND_STARTED:      u32 round
+// - PHASE_STARTED:      u8 phase
+// - ORDER_ISSUED:       u8 order type, u16 issuer, u16 target player, i32 armies, u32 source, u32 destination
+// - ORDER_EXECUTED:     same as ORDER_ISSUED, then u8 valid, i32 source army delta, i32 destination army delta
+// - TERRITORY_CAPTURED: u32 territory, u16 new owner
+// - CARD_DRAWN:         u16 player, u8 card type
+// - TURN_ENDED:         u16 player
+// - PLAYER_ELIMINATED:  u16 player
+// - ROUND_ENDED:        u32 round, u64 state hash
+// - GAME_ENDED:         u32 number of rounds
+enum RecordedEvent : uint8_t
+{
+    GAME_STARTED,
+    PLAYER_JOINED,
+    ROUND_STARTED,
+    PHASE_STARTED,
+    ORDER_ISSUED,
+    ORDER_EXECUTED,
+    TERRITORY_CAPTURED,
+    CARD_DRAWN,
+    TURN_ENDED,
+    PLAYER_ELIMINATED,
+    ROUND_ENDED,
+    GAME_ENDED,
+};
+
+class GameRecorder
+{
+public:
+    static constexpr uint32_t MAGIC = 0x43525a57; // "WZRC"
+    static constexpr uint16_t VERSION = 1;
+    static constexpr uint16_t NO_PLAYER = 0xFFFF;
+    static constexpr uint32_t NO_TERRITORY = 0xFFFFFFFF;
+
+    GameRecorder(std::string filename);
+    ~GameRecorder();
+    friend std::ostream &operator<<(std::ostream &output, const GameRecorder &recorder);
+    uint32_t getRound() const;
+    uint64_t getBytesWritten() const;
+    uint64_t hashState() const;
+    static uint64_t hashState(const std::vector<Territory*> &territories, const std::unordered_map<Player*, uint16_t> &playerIds);
+    void recordGameStart(unsigned int seed, Map* map, std::vector<Player*> players);
+    void recordRoundStart();
+    void recordPhase(Phase phase);
+    void recordOrderIssued(const Order* order);
+    void beginOrderExecution(const Order* order);
+    void recordOrderExecuted(const Order* order, bool valid);
+    void recordOwnershipChange(Territory* territory, Player* newOwner);
+    void recordCardDrawn(Player* player, const Card* card);
+    void recordTurnEnd(Player* player);
+    void recordPlayerEliminated(Player* player);
+    void recordRoundEnd();
+    void recordGameEnd();
+    void flush();
+
+private:
+    std::string filename_;
+    std::ofstream output_;
+    std::vector<char> buffer_;
+    uint64_t bytesWritten_;
+    uint32_t round_;
+    std::unordered_map<Player*, uint16_t> playerIds_;
+    uint16_t nextPlayerId_;
+    std::vector<Territory*> territories_;
+    int sourceArmiesBefore_;
+    int destinationArmiesBefore_;
+    uint16_t getPlayerId_(Player* player);
+    void writeOrder_(RecordedEvent event, const Order* order);
+    void endEvent_();
+
+    template <typename T>
+    void write_(T value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+    }
+};
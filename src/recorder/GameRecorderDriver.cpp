@@ -0,0 +1,43 @@
+#include "GameRecorder.h"
+#include "../game_engine/GameEngine.h"
+#include "../map_loader/MapLoader.h"
+
+int main()
+{
+    // Setup
+    GameEngine gameEngine;
+    MapLoader loader;
+
+    Player* player1 = new Player("Player 1", new AggressivePlayerStrategy());
+    Player* player2 = new Player("Player 2", new BenevolentPlayerStrategy());
+    Player* player3 = new Player("Player 3", new AggressivePlayerStrategy());
+
+    gameEngine.setMap(loader.loadMap("resources/canada.map"));
+    gameEngine.setPlayers({ player1, player2, player3 });
+    GameEngine::getDeck()->generateCards(20);
+    GameEngine::setSeed(42);
+
+    // Every event from here on is appended to `game.wzr`
+    GameEngine::setRecorder(new GameRecorder("game.wzr"));
+    gameEngine.startupPhase();
+
+    const int NUMBER_OF_ROUNDS = 10;
+    for (int round = 1; round <= NUMBER_OF_ROUNDS; round++)
+    {
+        std::cout << "\n============================ Recorded game: Round " << round << " ============================" << std::endl;
+        gameEngine.reinforcementPhase();
+        gameEngine.issueOrdersPhase();
+        gameEngine.executeOrdersPhase();
+    }
+
+    GameRecorder* recorder = GameEngine::getRecorder();
+    recorder->recordGameEnd();
+
+    std::cout << "\n" << *recorder << std::endl;
+    std::cout << "Final state hash: " << std::hex << recorder->hashState() << std::dec << std::endl;
+
+    // Clean up dynamically allocated memory (this also closes the recording file)
+    GameEngine::resetGameEngine();
+
+    return 0;
+}
@@ -0,0 +1,378 @@
+#include "GameReplay.h"
+#include "../game_engine/GameEngine.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    // Stand-in strategy for replayed players. Their orders come from the recording, so it never issues anything.
+    class ReplayedPlayerStrategy : public PlayerStrategy
+    {
+        public:
+            PlayerStrategy* clone() const
+            {
+                return new ReplayedPlayerStrategy();
+            }
+
+            std::vector<Territory*> toDefend(const Player* player) const
+            {
+                return player->getOwnedTerritories();
+            }
+
+            std::vector<Territory*> toAttack(const Player*) const
+            {
+                return {};
+            }
+
+            void issueOrder(Player*) {}
+
+        protected:
+            std::ostream &print_(std::ostream &output) const
+            {
+                output << "[ReplayedPlayerStrategy]";
+                return output;
+            }
+    };
+}
+
+
+/* 
+===================================
+ Implementation for GameReplay class
+===================================
+ */
+
+// Constructor. Takes ownership of `map`, which must be the map the recorded game was played on.
+GameReplay::GameReplay(std::string filename, Map* map)
+    : position_(0),
+      initialMap_(map),
+      currentRound_(0),
+      completedRounds_(0),
+      finished_(false),
+      numberOfOrdersExecuted_(0),
+      rosterInstalled_(false)
+{
+    std::ifstream recordingFile(filename, std::ios::binary);
+    if (!recordingFile.is_open())
+    {
+        throw "Unable to open recording file";
+    }
+
+    data_.assign(std::istreambuf_iterator<char>(recordingFile), std::istreambuf_iterator<char>());
+    recordingFile.close();
+
+    restart_();
+}
+
+// Destructor
+GameReplay::~GameReplay()
+{
+    delete initialMap_;
+    initialMap_ = nullptr;
+}
+
+// Operator overloading
+std::ostream &operator<<(std::ostream &output, const GameReplay &replay)
+{
+    output << "[GameReplay] " << replay.completedRounds_ << " rounds replayed, " << replay.numberOfOrdersExecuted_ << " orders executed, ";
+    output << (replay.isVerified() ? "state verified" : "state mismatch");
+    return output;
+}
+
+// Getters
+uint32_t GameReplay::getRound() const
+{
+    return completedRounds_;
+}
+
+uint32_t GameReplay::getNumberOfOrdersExecuted() const
+{
+    return numberOfOrdersExecuted_;
+}
+
+std::vector<uint32_t> GameReplay::getMismatchedRounds() const
+{
+    return mismatchedRounds_;
+}
+
+bool GameReplay::isFinished() const
+{
+    return finished_;
+}
+
+// Check whether the state hash of every replayed round matched the one that was recorded
+bool GameReplay::isVerified() const
+{
+    return mismatchedRounds_.empty();
+}
+
+// Replay the game until the end of the specified round. Seeking backwards restarts the replay from the beginning.
+void GameReplay::seekToRound(uint32_t round)
+{
+    if (round < completedRounds_)
+    {
+        restart_();
+    }
+
+    while (completedRounds_ < round && !finished_)
+    {
+        finished_ = !replayNextEvent_();
+    }
+}
+
+// Replay every remaining event of the recording
+void GameReplay::replayToEnd()
+{
+    while (!finished_)
+    {
+        finished_ = !replayNextEvent_();
+    }
+}
+
+// Reset the game engine to the initial map with no players and rewind to the start of the recording.
+void GameReplay::restart_()
+{
+    GameEngine::setPlayers({});
+    GameEngine::setMap(new Map(*initialMap_));
+
+    territories_ = GameEngine::getMap()->getTerritories();
+    sort(territories_.begin(), territories_.end(), [](auto t1, auto t2) { return t1->getId() < t2->getId(); });
+
+    position_ = 0;
+    currentRound_ = 0;
+    completedRounds_ = 0;
+    finished_ = false;
+    numberOfOrdersExecuted_ = 0;
+    rosterInstalled_ = false;
+    players_.clear();
+    playerIds_.clear();
+    mismatchedRounds_.clear();
+
+    if (read_<uint32_t>() != GameRecorder::MAGIC || read_<uint16_t>() != GameRecorder::VERSION)
+    {
+        throw "Invalid recording file.";
+    }
+}
+
+// Read and apply the next event in the recording. Returns `false` once the end of the game is reached.
+bool GameReplay::replayNextEvent_()
+{
+    if (position_ == data_.size())
+    {
+        return false;
+    }
+
+    RecordedEvent event = static_cast<RecordedEvent>(read_<uint8_t>());
+
+    // Players joining before anything else happens make up the starting roster, in turn order
+    if (!rosterInstalled_ && event != GAME_STARTED && event != PLAYER_JOINED)
+    {
+        installRoster_();
+    }
+
+    switch (event)
+    {
+        case GAME_STARTED:
+        {
+            GameEngine::setSeed(read_<uint32_t>());
+            if (read_<uint32_t>() != territories_.size())
+            {
+                throw "The recording was not made on this map.";
+            }
+            break;
+        }
+        case PLAYER_JOINED:
+        {
+            uint16_t playerId = read_<uint16_t>();
+            bool neutral = read_<uint8_t>();
+            uint16_t nameLength = read_<uint16_t>();
+            std::string name;
+            for (int i = 0; i < nameLength; i++)
+            {
+                name.push_back(read_<char>());
+            }
+
+            players_.resize(std::max<size_t>(players_.size(), playerId + 1), nullptr);
+
+            // Players created mid-game (e.g. the Neutral Player) are created again by the orders that are replayed
+            if (!rosterInstalled_)
+            {
+                Player* player = new Player(name, neutral ? (PlayerStrategy*)new NeutralPlayerStrategy() : new ReplayedPlayerStrategy());
+                players_.at(playerId) = player;
+                playerIds_[player] = playerId;
+            }
+            break;
+        }
+        case ROUND_STARTED:
+            currentRound_ = read_<uint32_t>();
+            break;
+        case PHASE_STARTED:
+            read_<uint8_t>();
+            break;
+        case ORDER_ISSUED:
+        case ORDER_EXECUTED:
+        {
+            OrderType type = static_cast<OrderType>(read_<uint8_t>());
+            Player* issuer = getPlayer_(read_<uint16_t>());
+            Player* target = getPlayer_(read_<uint16_t>());
+            int armies = read_<int32_t>();
+            Territory* source = getTerritory_(read_<uint32_t>());
+            Territory* destination = getTerritory_(read_<uint32_t>());
+
+            if (event == ORDER_ISSUED)
+            {
+                // Re-apply the bookkeeping done by the strategies when they issue orders
+                if (type == DEPLOY && destination != nullptr)
+                {
+                    destination->addPendingIncomingArmies(armies);
+                }
+                else if ((type == ADVANCE || type == AIRLIFT) && source != nullptr)
+                {
+                    source->addPendingOutgoingArmies(armies);
+                }
+            }
+            else
+            {
+                // Skip the recorded outcome: it is reproduced by executing the order
+                read_<uint8_t>();
+                read_<int32_t>();
+                read_<int32_t>();
+
+                Order* order = buildOrder_(type, issuer, target, armies, source, destination);
+                order->execute();
+                delete order;
+                numberOfOrdersExecuted_++;
+            }
+            break;
+        }
+        case TERRITORY_CAPTURED:
+        {
+            Territory* territory = getTerritory_(read_<uint32_t>());
+            Player* owner = getPlayer_(read_<uint16_t>());
+
+            // Only the initial distribution is applied, later captures are reproduced by executing the orders
+            if (currentRound_ == 0)
+            {
+                owner->addOwnedTerritory(territory);
+            }
+            break;
+        }
+        case CARD_DRAWN:
+            read_<uint16_t>();
+            read_<uint8_t>();
+            break;
+        case TURN_ENDED:
+        {
+            Player* player = getPlayer_(read_<uint16_t>());
+            if (player != nullptr)
+            {
+                player->endTurn();
+            }
+            break;
+        }
+        case PLAYER_ELIMINATED:
+            playerIds_.erase(getPlayer_(read_<uint16_t>()));
+            break;
+        case ROUND_ENDED:
+        {
+            uint32_t round = read_<uint32_t>();
+            uint64_t recordedHash = read_<uint64_t>();
+
+            // Make sure players who joined during the round are matched before comparing the states
+            for (uint16_t playerId = 0; playerId < players_.size(); playerId++)
+            {
+                getPlayer_(playerId);
+            }
+
+            if (GameRecorder::hashState(territories_, playerIds_) != recordedHash)
+            {
+                mismatchedRounds_.push_back(round);
+            }
+            completedRounds_ = round;
+            break;
+        }
+        case GAME_ENDED:
+            read_<uint32_t>();
+            return false;
+        default:
+            throw "Corrupted recording: unknown event.";
+    }
+
+    return true;
+}
+
+// Hand the starting roster over to the game engine
+void GameReplay::installRoster_()
+{
+    std::vector<Player*> roster;
+    for (const auto &player : players_)
+    {
+        if (player != nullptr)
+        {
+            roster.push_back(player);
+        }
+    }
+
+    GameEngine::setPlayers(roster);
+    rosterInstalled_ = true;
+}
+
+// Get the replayed player with the specified recorded id.
+// A player that joined mid-game is matched with the Neutral Player once the game engine has created it.
+Player* GameReplay::getPlayer_(uint16_t playerId)
+{
+    if (playerId == GameRecorder::NO_PLAYER)
+    {
+        return nullptr;
+    }
+
+    if (playerId >= players_.size())
+    {
+        throw "Corrupted recording: unknown player.";
+    }
+
+    // The only player the game engine creates by itself is the Neutral Player
+    Player* neutralPlayer = GameEngine::getNeutralPlayer();
+    bool neutralPlayerMatched = find(players_.begin(), players_.end(), neutralPlayer) != players_.end();
+    if (players_.at(playerId) == nullptr && neutralPlayer != nullptr && !neutralPlayerMatched)
+    {
+        players_.at(playerId) = neutralPlayer;
+        playerIds_[neutralPlayer] = playerId;
+    }
+
+    return players_.at(playerId);
+}
+
+// Get the territory with the specified id
+Territory* GameReplay::getTerritory_(uint32_t territoryId)
+{
+    if (territoryId == GameRecorder::NO_TERRITORY)
+    {
+        return nullptr;
+    }
+
+    return territories_.at(territoryId);
+}
+
+// Rebuild an order from its recorded arguments
+Order* GameReplay::buildOrder_(OrderType type, Player* issuer, Player* target, int armies, Territory* source, Territory* destination)
+{
+    switch (type)
+    {
+        case DEPLOY:
+            return new DeployOrder(issuer, armies, destination);
+        case ADVANCE:
+            return new AdvanceOrder(issuer, armies, source, destination);
+        case BOMB:
+            return new BombOrder(issuer, destination);
+        case BLOCKADE:
+            return new BlockadeOrder(issuer, destination);
+        case AIRLIFT:
+            return new AirliftOrder(issuer, armies, source, destination);
+        case NEGOTIATE:
+            return new NegotiateOrder(issuer, target);
+        default:
+            throw "Corrupted recording: unknown order type.";
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "GameRecorder.h"
+#include "../map/Map.h"
+#include "../orders/Orders.h"
+#include "../player/Player.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GameReplay
+{
+public:
+    GameReplay(std::string filename, Map* map);
+    ~GameReplay();
+    friend std::ostream &operator<<(std::ostream &output, const GameReplay &replay);
+    uint32_t getRound() const;
+    uint32_t getNumberOfOrdersExecuted() const;
+    std::vector<uint32_t> getMismatchedRounds() const;
+    bool isFinished() const;
+    bool isVerified() const;
+    void seekToRound(uint32_t round);
+    void replayToEnd();
+
+private:
+    std::vector<char> data_;
+    size_t position_;
+    Map* initialMap_;
+    uint32_t currentRound_;
+    uint32_t completedRounds_;
+    bool finished_;
+    uint32_t numberOfOrdersExecuted_;
+    bool rosterInstalled_;
+    std::vector<Territory*> territories_;
+    std::vector<Player*> players_;
+    std::unordered_map<Player*, uint16_t> playerIds_;
+    std::vector<uint32_t> mismatchedRounds_;
+    void restart_();
+    bool replayNextEvent_();
+    void installRoster_();
+    Player* getPlayer_(uint16_t playerId);
+    Territory* getTerritory_(uint32_t territoryId);
+    Order* buildOrder_(OrderType type, Player* issuer, Player* target, int armies, Territory* source, Territory* destination);
+
+    template <typename T>
+    T read_()
+    {
+        if (position_ + sizeof(T) > data_.size())
+        {
+            throw "Corrupted recording: unexpected end of file.";
+        }
+
+        T value;
+        std::copy(data_.begin() + position_, data_.begin() + position_ + sizeof(T), reinterpret_cast<char*>(&value));
+        position_ += sizeof(T);
+        return value;
+    }
+};
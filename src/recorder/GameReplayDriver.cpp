@@ -0,0 +1,42 @@
+#include "GameReplay.h"
+#include "../game_engine/GameEngine.h"
+#include "../logging/Logger.h"
+#include "../map_loader/MapLoader.h"
+#include <chrono>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    // Usage: GameReplayDriver [recording] [map] [round]
+    // Defaults to the recording made by GameRecorderDriver.
+    std::string recordingFile = argc > 1 ? argv[1] : "game.wzr";
+    std::string mapFile = argc > 2 ? argv[2] : "resources/canada.map";
+    int seekRound = argc > 3 ? std::stoi(argv[3]) : 5;
+
+    MapLoader loader;
+    GameReplay replay(recordingFile, loader.loadMap(mapFile));
+
+    // Silence the output of the orders while replaying
+    Logger::setLevel(OFF_LEVEL);
+
+    auto start = std::chrono::steady_clock::now();
+    replay.seekToRound(seekRound);
+    auto seekEnd = std::chrono::steady_clock::now();
+    uint32_t roundReached = replay.getRound();
+    replay.replayToEnd();
+    auto end = std::chrono::steady_clock::now();
+
+    auto toMicroseconds = [](auto duration) { return std::chrono::duration_cast<std::chrono::microseconds>(duration).count(); };
+    std::cout << "Reached round " << roundReached << " in " << toMicroseconds(seekEnd - start) << " us" << std::endl;
+    std::cout << "Replayed the whole game in " << toMicroseconds(end - start) << " us" << std::endl;
+    std::cout << replay << std::endl;
+
+    for (const auto &round : replay.getMismatchedRounds())
+    {
+        std::cout << "State hash mismatch at the end of round " << round << std::endl;
+    }
+
+    GameEngine::resetGameEngine();
+
+    return replay.isVerified() ? 0 : 1;
+}
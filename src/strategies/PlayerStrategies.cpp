@@ -1,9 +1,11 @@
 #include "PlayerStrategies.h"
 #include "../game_engine/GameEngine.h"
+#include "../game_engine/GameScheduler.h"
+#include "../logging/Logger.h"
 #include "../orders/Orders.h"
 #include <algorithm>
 #include <math.h>
-#include <time.h>
+#include <sstream>
 #include <unordered_set>
 
 namespace
@@ -47,12 +49,22 @@ namespace
 ===================================
  */
 
+// Destructor
+PlayerStrategy::~PlayerStrategy() {}
+
 // Operator overloading
 std::ostream &operator<<(std::ostream &output, const PlayerStrategy &strategy)
 {
     return strategy.print_(output);
 }
 
+// Issue an order like issueOrder(). Strategies waiting for input override this to suspend the game in the meantime.
+GameTask PlayerStrategy::issueOrderAsync(Player* player)
+{
+    player->issueOrder();
+    co_return;
+}
+
 
 
 /* 
@@ -74,13 +86,10 @@ PlayerStrategy* AggressivePlayerStrategy::clone() const
     return new AggressivePlayerStrategy();
 }
 
-// Return a list of territories to defend
+// Return a list of territories to defend, strongest first
 std::vector<Territory*> AggressivePlayerStrategy::toDefend(const Player* player) const
 {
-    std::vector<Territory*> territoriesToDefend = player->ownedTerritories_;
-    auto sortLambda = [](auto t1, auto t2){ return t1->getNumberOfArmies() > t2->getNumberOfArmies(); };
-    sort(territoriesToDefend.begin(), territoriesToDefend.end(), sortLambda);
-    return territoriesToDefend;
+    return player->territoriesByStrength_.getStrongest(player->territoriesByStrength_.size());
 }
 
 // Return a list of territories to attack
@@ -99,7 +108,7 @@ std::vector<Territory*> AggressivePlayerStrategy::toAttack(const Player* player)
 
         for (const auto &neighbor : adjacentTerritories)
         {
-            bool isEnemyOwned = find(sources.begin(), sources.end(), neighbor) == sources.end();
+            bool isEnemyOwned = GameEngine::getOwnerOf(neighbor) != player;
             bool alreadySeen = territoriesSeen.find(neighbor) != territoriesSeen.end();
 
             if (isEnemyOwned && !alreadySeen)
@@ -120,19 +129,19 @@ std::vector<Territory*> AggressivePlayerStrategy::toAttack(const Player* player)
 // - Advance all armies from the strongest territory to another territory (if surrounded by fristd::endly territories)
 void AggressivePlayerStrategy::issueOrder(Player* player)
 {
-    std::vector<Territory*> territoriesToAttack = toAttack(player);
-    std::vector<Territory*> territoriesToDefend = toDefend(player);
+    // Only the top priority territory of `toDefend()` is needed, which the player keeps track of
+    Territory* topTerritory = player->territoriesByStrength_.getStrongest();
 
-    bool finishedDeploying = deployToTopTerritory_(player, territoriesToDefend);
+    bool finishedDeploying = deployToTopTerritory_(player, topTerritory);
     if (finishedDeploying)
     {
-        bool finishedPlayingCards = playCard_(player, territoriesToDefend);
+        bool finishedPlayingCards = playCard_(player, topTerritory);
         if (finishedPlayingCards)
         {
-            bool finishedAttacking = attackFromTopTerritory_(player, territoriesToDefend.front(), territoriesToAttack);
+            bool finishedAttacking = attackFromTopTerritory_(player, topTerritory);
             if (finishedAttacking)
             {
-                bool finishedIssuingOrders = advanceToRandomTerritory_(player, territoriesToDefend);
+                bool finishedIssuingOrders = advanceToRandomTerritory_(player, topTerritory);
                 player->committed_ = finishedIssuingOrders;
             }
         }
@@ -143,27 +152,26 @@ void AggressivePlayerStrategy::issueOrder(Player* player)
 // Deploy all reinforcements to the strongest territory (the one with the most armies already present).
 // Returns `true` if finished deploying/no new order was issued.
 // Returns `false` if there was an order issued.
-bool AggressivePlayerStrategy::deployToTopTerritory_(Player* player, std::vector<Territory*> territoriesToDefend)
+bool AggressivePlayerStrategy::deployToTopTerritory_(Player* player, Territory* topTerritory)
 {
     if (player->reinforcements_ == 0)
     {
         return true;
     }
     
-    Territory* topTerritory = territoriesToDefend.front();
     DeployOrder* order = new DeployOrder(player, player->reinforcements_, topTerritory);
     player->addOrder(order);
     topTerritory->addPendingIncomingArmies(player->reinforcements_);
     player->reinforcements_ = 0;
 
-    std::cout << "Issued: " << *order << std::endl;
+    LOG_INFO("Issued: " << *order << "\n");
     return false;
 }
 
 // Advance all armies from strongest territory to an enemy territory.
 // Returns `true` if finished attacking or has no one to attack/no new order was issued.
 // Returns `false` if there was an order issued.
-bool AggressivePlayerStrategy::attackFromTopTerritory_(Player* player, Territory* attackFrom, std::vector<Territory*> territoriesToAttack)
+bool AggressivePlayerStrategy::attackFromTopTerritory_(Player* player, Territory* attackFrom)
 {
     Map* map = GameEngine::getMap();
     int movableArmies = attackFrom->getNumberOfMovableArmies();
@@ -172,17 +180,17 @@ bool AggressivePlayerStrategy::attackFromTopTerritory_(Player* player, Territory
     {
         for (const auto &territory : map->getAdjacentTerritories(attackFrom))
         {
-            bool isEnemyTerritory = find(territoriesToAttack.begin(), territoriesToAttack.end(), territory) != territoriesToAttack.end();
-            bool alreadyAdvancedToTerritory = player->advancePairingExists_(attackFrom, territory);
+            bool isEnemyTerritory = GameEngine::getOwnerOf(territory) != player;
+            bool alreadyAdvancedToTerritory = player->issuedMoves_.hasAdvanced(attackFrom->getId(), territory->getId());
 
             if (isEnemyTerritory && !alreadyAdvancedToTerritory)
             {
                 AdvanceOrder* order = new AdvanceOrder(player, movableArmies, attackFrom, territory);
                 player->addOrder(order);
                 attackFrom->addPendingOutgoingArmies(movableArmies);
-                player->issuedDeploymentsAndAdvancements_[attackFrom].push_back(territory);
+                player->issuedMoves_.recordAdvance(attackFrom->getId(), territory->getId());
                 
-                std::cout << "Issued: " << *order << std::endl;
+                LOG_INFO("Issued: " << *order << "\n");
                 return false;
             }
         }
@@ -196,9 +204,8 @@ bool AggressivePlayerStrategy::attackFromTopTerritory_(Player* player, Territory
 // when the territory doesn't have any surrounding enemy territories to attack.
 // Returns `true` if finished advanstd::cing/no new order was issued.
 // Returns `false` if there was an order issued.
-bool AggressivePlayerStrategy::advanceToRandomTerritory_(Player* player, std::vector<Territory*> territoriesToDefend)
+bool AggressivePlayerStrategy::advanceToRandomTerritory_(Player* player, Territory* topTerritory)
 {
-    Territory* topTerritory = territoriesToDefend.front();
     int movableArmies = topTerritory->getNumberOfMovableArmies();
 
     // If the player hasn't already moved all the armies to attack an enemy, move to another fristd::endly territory
@@ -207,16 +214,15 @@ bool AggressivePlayerStrategy::advanceToRandomTerritory_(Player* player, std::ve
         std::vector<Territory*> adjacentTerritories = GameEngine::getMap()->getAdjacentTerritories(topTerritory);
         
         // Pick a random destination
-        srand(time(nullptr));
-        int randomIndex = rand() % adjacentTerritories.size();
+        int randomIndex = player->getRandomIndex(adjacentTerritories.size());
         Territory* destination = adjacentTerritories.at(randomIndex);
         
         AdvanceOrder* order = new AdvanceOrder(player, movableArmies, topTerritory, destination);
         player->addOrder(order);
         topTerritory->addPendingOutgoingArmies(movableArmies);
-        player->issuedDeploymentsAndAdvancements_[topTerritory].push_back(destination);
+        player->issuedMoves_.recordAdvance(topTerritory->getId(), destination->getId());
         
-        std::cout << "Issued: " << *order << std::endl;
+        LOG_INFO("Issued: " << *order << "\n");
         return false;
     }
 
@@ -226,7 +232,7 @@ bool AggressivePlayerStrategy::advanceToRandomTerritory_(Player* player, std::ve
 // Helper method to play a random Card from the Player's hand, if any.
 // Returns `true` if the Player has no more cards to play/no new order was issued.
 // Returns `false` if there was an order issued.
-bool AggressivePlayerStrategy::playCard_(Player* player, std::vector<Territory*> territoriesToDefend)
+bool AggressivePlayerStrategy::playCard_(Player* player, Territory* topTerritory)
 {
     Hand* playerHand = player->hand_;
     if (playerHand->size() == 0)
@@ -235,24 +241,23 @@ bool AggressivePlayerStrategy::playCard_(Player* player, std::vector<Territory*>
     }
 
     // Play a random card from hand
-    int randomCardIndex = rand() % playerHand->size();
-    Card* card = playerHand->removeCard(randomCardIndex);
-    Order* order = card->play();
-    std::cout << "Played: " << *card << std::endl;
+    int randomCardIndex = player->getRandomIndex(playerHand->size());
+    const Card* card = playerHand->removeCard(randomCardIndex);
+    Order* order = card->play(player);
+    LOG_INFO("Played: " << *card << "\n");
 
     // Return the played card back to the deck
-    card->setOwner(nullptr);
-    GameEngine::getDeck()->addCard(card);
+    player->returnCardToDeck(card);
 
     if (order != nullptr)
     {
         player->addOrder(order);
-        std::cout << "Issued: " << *order << std::endl;
+        LOG_INFO("Issued: " << *order << "\n");
     }
     else if (player->reinforcements_ > 0)
     {
         // Reinforcement card played: deploy the additional reinforcements
-        deployToTopTerritory_(player, territoriesToDefend);
+        deployToTopTerritory_(player, topTerritory);
     }
 
     return false;
@@ -279,17 +284,14 @@ PlayerStrategy* BenevolentPlayerStrategy::clone() const
     return new BenevolentPlayerStrategy();
 }
 
-// Return a list of territories to defend
+// Return a list of territories to defend, weakest first
 std::vector<Territory*> BenevolentPlayerStrategy::toDefend(const Player* player) const
 {
-    std::vector<Territory*> territoriesToDefend = player->ownedTerritories_;
-    auto sortLambda = [](auto t1, auto t2){ return t1->getNumberOfArmies() < t2->getNumberOfArmies(); };
-    sort(territoriesToDefend.begin(), territoriesToDefend.end(), sortLambda);
-    return territoriesToDefend;
+    return player->territoriesByStrength_.getWeakest(player->territoriesByStrength_.size());
 }
 
 // Return an empty list of territories to attack (since this strategy never attacks)
-std::vector<Territory*> BenevolentPlayerStrategy::toAttack(const Player* player) const
+std::vector<Territory*> BenevolentPlayerStrategy::toAttack(const Player*) const
 {
     return {};
 }
@@ -333,10 +335,9 @@ bool BenevolentPlayerStrategy::deployToWeakTerritories_(Player* player, std::vec
     Territory* destination = territoriesToDefend.front();
     for (const auto &territory : territoriesToDefend)
     {
-        if (player->issuedDeploymentsAndAdvancements_.find(territory) == player->issuedDeploymentsAndAdvancements_.end())
+        if (!player->issuedMoves_.hasDeployedTo(territory->getId()))
         {
-            // Initialize the vector at the key specified by this territory
-            player->issuedDeploymentsAndAdvancements_[territory];
+            player->issuedMoves_.recordDeployment(territory->getId());
             destination = territory;
             break;
         }
@@ -347,7 +348,7 @@ bool BenevolentPlayerStrategy::deployToWeakTerritories_(Player* player, std::vec
     destination->addPendingIncomingArmies(armiesToDeploy);
     player->reinforcements_ -= armiesToDeploy;
     
-    std::cout << "Issued: " << *order << std::endl;
+    LOG_INFO("Issued: " << *order << "\n");
     return false;
 }
 
@@ -369,8 +370,8 @@ bool BenevolentPlayerStrategy::fortifyWeakTerritories_(Player* player, std::vect
 
             for (const auto &neighbor : adjacentTerritories)
             {
-                bool isFriendlyTerritory = find(territoriesToDefend.begin(), territoriesToDefend.end(), neighbor) != territoriesToDefend.end();
-                bool alreadyAdvancedToTerritory = player->advancePairingExists_(territory, neighbor);
+                bool isFriendlyTerritory = GameEngine::getOwnerOf(neighbor) == player;
+                bool alreadyAdvancedToTerritory = player->issuedMoves_.hasAdvanced(territory->getId(), neighbor->getId());
 
                 if (isFriendlyTerritory && !alreadyAdvancedToTerritory)
                 {
@@ -378,9 +379,9 @@ bool BenevolentPlayerStrategy::fortifyWeakTerritories_(Player* player, std::vect
                     AdvanceOrder* order = new AdvanceOrder(player, armiesToMove, territory, neighbor);
                     player->addOrder(order);
                     territory->addPendingOutgoingArmies(armiesToMove);
-                    player->issuedDeploymentsAndAdvancements_[territory].push_back(neighbor);
+                    player->issuedMoves_.recordAdvance(territory->getId(), neighbor->getId());
                     
-                    std::cout << "Issued: " << *order << std::endl;
+                    LOG_INFO("Issued: " << *order << "\n");
                     return false;
                 }
             }
@@ -399,30 +400,29 @@ bool BenevolentPlayerStrategy::playCard_(Player* player, std::vector<Territory*>
 
     if (playerHand->size() != 0)
     {
-        // Select a card from hand that isn't a BombCard
-        Card* card = nullptr;
-        for (int i = 0; i < playerHand->size(); i++)
+        // Select a card from hand that isn't a BombCard. Hands don't keep the order cards were drawn in, so this is the
+        // first such card in CardType order (reinforcement, blockade, airlift, then diplomacy), not the earliest drawn.
+        const Card* card = nullptr;
+        for (int type = 0; type < NUMBER_OF_CARD_TYPES && card == nullptr; type++)
         {
-            if (dynamic_cast<BombCard*>(playerHand->at(i)) == nullptr)
+            if (type != BOMB_CARD)
             {
-                card = playerHand->removeCard(i);
-                break;
+                card = playerHand->removeCard(static_cast<CardType>(type));
             }
         }
 
         if (card != nullptr)
         {
-            Order* order = card->play();
-            std::cout << "Played: " << *card << std::endl;
+            Order* order = card->play(player);
+            LOG_INFO("Played: " << *card << "\n");
 
             // Return the played card back to the deck
-            card->setOwner(nullptr);
-            GameEngine::getDeck()->addCard(card);
+            player->returnCardToDeck(card);
 
             if (order != nullptr)
             {
                 player->addOrder(order);
-                std::cout << "Issued: " << *order << std::endl << std::endl;
+                LOG_INFO("Issued: " << *order << "\n\n");
             }
             else if (player->reinforcements_ > 0)
             {
@@ -476,7 +476,7 @@ std::vector<Territory*> HumanPlayerStrategy::toAttack(const Player* player) cons
     {
         for (const auto &neighbor : map->getAdjacentTerritories(territory))
         {
-            bool isEnemyOwned = find(ownedTerritories.begin(), ownedTerritories.end(), neighbor) == ownedTerritories.end();
+            bool isEnemyOwned = GameEngine::getOwnerOf(neighbor) != player;
             bool alreadySeen = territoriesSeen.find(neighbor) != territoriesSeen.end();
 
             if (isEnemyOwned && !alreadySeen)
@@ -522,7 +522,7 @@ void HumanPlayerStrategy::issueOrder(Player* player)
 
             if (selection == "A")
             {
-                issueAdvance_(player, territoriesToDefend);
+                issueAdvance_(player);
                 break;
             }
             else if (selection == "P")
@@ -544,7 +544,7 @@ void HumanPlayerStrategy::deployReinforcements_(Player* player, std::vector<Terr
 {
     std::cout << "You have " << player->reinforcements_ << " reinforcements left." << std::endl;
     std::cout << "\nWhere would you like to deploy to?" << std::endl;
-    for (int i = 0; i < territoriesToDefend.size(); i++)
+    for (size_t i = 0; i < territoriesToDefend.size(); i++)
     {
         Territory* territory = territoriesToDefend.at(i);
         std::cout << "[" << i+1 << "] " << territory->getName() << " (" << territory->getNumberOfArmies() << " present, " << territory->getPendingIncomingArmies() << " pending)" << std::endl;
@@ -557,7 +557,7 @@ void HumanPlayerStrategy::deployReinforcements_(Player* player, std::vector<Terr
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= territoriesToDefend.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(territoriesToDefend.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -591,16 +591,16 @@ void HumanPlayerStrategy::deployReinforcements_(Player* player, std::vector<Terr
     deployTarget->addPendingIncomingArmies(armiesToDeploy);
     player->reinforcements_ -= armiesToDeploy;
     
-    std::cout << "Issued: " << *order << std::endl << std::endl;
+    LOG_INFO("Issued: " << *order << "\n\n");
 }
 
 // Issue an advance order to either fortify or attack a territory
-void HumanPlayerStrategy::issueAdvance_(Player* player, std::vector<Territory*> territoriesToDefend)
+void HumanPlayerStrategy::issueAdvance_(Player* player)
 {
     std::vector<Territory*> possibleSources = player->getOwnTerritoriesWithMovableArmies();
 
     std::cout << "\nWhich territory would you like to advance from?" << std::endl;
-    for (int i = 0; i < possibleSources.size(); i++)
+    for (size_t i = 0; i < possibleSources.size(); i++)
     {
         Territory* territory = possibleSources.at(i);
         std::cout << "[" << i+1 << "] " << territory->getName() << " (" << territory->getNumberOfMovableArmies() << " armies available)" << std::endl;
@@ -613,7 +613,7 @@ void HumanPlayerStrategy::issueAdvance_(Player* player, std::vector<Territory*>
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= possibleSources.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(possibleSources.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -630,7 +630,7 @@ void HumanPlayerStrategy::issueAdvance_(Player* player, std::vector<Territory*>
     std::vector<Territory*> defendable;
     for (const auto &neighbor : map->getAdjacentTerritories(source))
     {
-        if (find(territoriesToDefend.begin(), territoriesToDefend.end(), neighbor) != territoriesToDefend.end())
+        if (GameEngine::getOwnerOf(neighbor) == player)
         {
             defendable.push_back(neighbor);
         }
@@ -640,7 +640,7 @@ void HumanPlayerStrategy::issueAdvance_(Player* player, std::vector<Territory*>
         }
     }
 
-    int i = 0;
+    size_t i = 0;
     std::cout << "\nWhich territory would you like to advance to?" << std::endl;
     if (!defendable.empty())
     {
@@ -670,7 +670,7 @@ void HumanPlayerStrategy::issueAdvance_(Player* player, std::vector<Territory*>
         int selection;
         std::cin >> selection;
 
-        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= defendable.size() + attackable.size())
+        if (std::cin.fail() || selection - 1 < 0 || selection - 1 >= static_cast<int>(defendable.size() + attackable.size()))
         {
             std::cout << "That was not a valid option. Please try again:" << std::endl;
             std::cin.clear();
@@ -678,7 +678,7 @@ void HumanPlayerStrategy::issueAdvance_(Player* player, std::vector<Territory*>
             continue;
         }
 
-        if (selection <= defendable.size())
+        if (selection <= static_cast<int>(defendable.size()))
         {
             destination = defendable.at(selection - 1);
         }
@@ -711,7 +711,7 @@ void HumanPlayerStrategy::issueAdvance_(Player* player, std::vector<Territory*>
     player->addOrder(order);
     source->addPendingOutgoingArmies(armiesToMove);
     
-    std::cout << "Issued: " << *order << std::endl << std::endl;
+    LOG_INFO("Issued: " << *order << "\n\n");
 }
 
 // Play a card from the player's hand
@@ -720,13 +720,13 @@ void HumanPlayerStrategy::playCard_(Player* player, std::vector<Territory*> terr
     Hand* playerHand = player->hand_;
 
     std::cout << "\nWhich card would you like to play?" << std::endl;
-    for (int i = 0; i < playerHand->size(); i++)
+    std::vector<const Card*> cards = playerHand->getCards();
+    for (size_t i = 0; i < cards.size(); i++)
     {
-        Card* card = playerHand->getCards().at(i);
-        std::cout << "[" << i+1 << "] " << *card << std::endl;
+        std::cout << "[" << i+1 << "] " << *cards.at(i) << std::endl;
     }
 
-    Card* card = nullptr;
+    const Card* card = nullptr;
     std::cout << "\nEnter the card to play: ";
     while (card == nullptr)
     {
@@ -744,16 +744,15 @@ void HumanPlayerStrategy::playCard_(Player* player, std::vector<Territory*> terr
         card = playerHand->removeCard(selection - 1);
     }
 
-    Order* order = card->play();
+    Order* order = card->play(player);
 
     // Return the played card back to the deck
-    card->setOwner(nullptr);
-    GameEngine::getDeck()->addCard(card);
+    player->returnCardToDeck(card);
 
     if (order != nullptr)
     {
         player->addOrder(order);
-        std::cout << "Issued: " << *order << std::endl << std::endl;
+        LOG_INFO("Issued: " << *order << "\n\n");
     }
     else if (player->reinforcements_ > 0)
     {
@@ -763,6 +762,162 @@ void HumanPlayerStrategy::playCard_(Player* player, std::vector<Territory*> terr
 
 
 
+/* 
+===================================
+ Implementation for RemotePlayerStrategy class
+===================================
+ */
+
+// Constructor. The channel belongs to the caller and is shared by all copies of the strategy.
+RemotePlayerStrategy::RemotePlayerStrategy(InputChannel* channel) : channel_(channel) {}
+
+// Operator overloading
+std::ostream &RemotePlayerStrategy::print_(std::ostream &output) const
+{
+    output << "[RemotePlayerStrategy]";
+    return output;
+}
+
+// Return a pointer to a new instance of RemotePlayerStrategy.
+PlayerStrategy* RemotePlayerStrategy::clone() const
+{
+    return new RemotePlayerStrategy(channel_);
+}
+
+// Return a list of territories to defend
+std::vector<Territory*> RemotePlayerStrategy::toDefend(const Player* player) const
+{
+    return player->ownedTerritories_;
+}
+
+// Return a list of territories to attack
+std::vector<Territory*> RemotePlayerStrategy::toAttack(const Player* player) const
+{
+    std::vector<Territory*> ownedTerritories = player->ownedTerritories_;
+    std::vector<Territory*> territoriesToAttack;
+    std::unordered_set<Territory*> territoriesSeen;
+    Map* map = GameEngine::getMap();
+
+    for (const auto &territory : ownedTerritories)
+    {
+        for (const auto &neighbor : map->getAdjacentTerritories(territory))
+        {
+            bool isEnemyOwned = GameEngine::getOwnerOf(neighbor) != player;
+            bool alreadySeen = territoriesSeen.find(neighbor) != territoriesSeen.end();
+
+            if (isEnemyOwned && !alreadySeen)
+            {
+                territoriesToAttack.push_back(neighbor);
+                territoriesSeen.insert(neighbor);
+            }
+        }
+    }
+
+    return territoriesToAttack;
+}
+
+// The client cannot be waited for outside of a GameScheduler, so the player commits without issuing any order
+void RemotePlayerStrategy::issueOrder(Player* player)
+{
+    LOG_WARNING("Remote players can only issue orders in games played by a GameScheduler.\n");
+    player->committed_ = true;
+}
+
+// Prompt the client and issue the order it answers with, suspending the game until the answer arrives
+GameTask RemotePlayerStrategy::issueOrderAsync(Player* player)
+{
+    channel_->prompt(describeTurn_(player));
+    std::string command = co_await channel_->nextLine();
+    runCommand_(player, command);
+}
+
+// Describe the player's turn for the client (see the class comment)
+std::string RemotePlayerStrategy::describeTurn_(const Player* player) const
+{
+    Map* map = GameEngine::getMap();
+    std::ostringstream description;
+    description << "reinforcements " << player->reinforcements_ << " orders " << player->orders_->size() << "\n";
+    for (const auto &territory : player->ownedTerritories_)
+    {
+        description << "territory " << territory->getId() << " " << territory->getNumberOfArmies() << " " << territory->getNumberOfMovableArmies();
+        for (const auto &neighbor : map->getAdjacentTerritories(territory))
+        {
+            description << " " << neighbor->getId();
+        }
+        description << "\n";
+    }
+
+    return description.str();
+}
+
+// Issue the order the client asked for, following the same rules as HumanPlayerStrategy: reinforcements must all be deployed
+// before advancing or committing
+void RemotePlayerStrategy::runCommand_(Player* player, const std::string &command)
+{
+    std::istringstream input(command);
+    std::string action;
+    input >> action;
+
+    auto findOwnedTerritory = [player](int id) -> Territory* {
+        auto hasId = [id](Territory* territory) { return territory->getId() == id; };
+        auto iterator = find_if(player->ownedTerritories_.begin(), player->ownedTerritories_.end(), hasId);
+        return iterator == player->ownedTerritories_.end() ? nullptr : *iterator;
+    };
+
+    if (action == "deploy")
+    {
+        int territoryId = -1;
+        int armies = 0;
+        input >> territoryId >> armies;
+        Territory* target = findOwnedTerritory(territoryId);
+        if (!input.fail() && target != nullptr && armies >= 1 && armies <= player->reinforcements_)
+        {
+            DeployOrder* order = new DeployOrder(player, armies, target);
+            player->addOrder(order);
+            target->addPendingIncomingArmies(armies);
+            player->reinforcements_ -= armies;
+
+            LOG_INFO("Issued: " << *order << "\n\n");
+            return;
+        }
+    }
+    else if (action == "advance" && player->reinforcements_ == 0)
+    {
+        int sourceId = -1;
+        int destinationId = -1;
+        int armies = 0;
+        input >> sourceId >> destinationId >> armies;
+        Territory* source = findOwnedTerritory(sourceId);
+        Territory* destination = nullptr;
+        if (!input.fail() && source != nullptr)
+        {
+            for (const auto &neighbor : GameEngine::getMap()->getAdjacentTerritories(source))
+            {
+                destination = neighbor->getId() == destinationId ? neighbor : destination;
+            }
+        }
+
+        if (destination != nullptr && armies >= 1 && armies <= source->getNumberOfMovableArmies())
+        {
+            AdvanceOrder* order = new AdvanceOrder(player, armies, source, destination);
+            player->addOrder(order);
+            source->addPendingOutgoingArmies(armies);
+
+            LOG_INFO("Issued: " << *order << "\n\n");
+            return;
+        }
+    }
+    else if (action == "done" && player->reinforcements_ == 0)
+    {
+        player->committed_ = true;
+        return;
+    }
+
+    LOG_INFO("Ignored invalid command from remote player: " << command << "\n");
+}
+
+
+
 /* 
 ===================================
  Implementation for NeutralPlayerStrategy class
@@ -783,19 +938,19 @@ PlayerStrategy* NeutralPlayerStrategy::clone() const
 }
 
 // Return an empty list of territories to defend
-std::vector<Territory*> NeutralPlayerStrategy::toDefend(const Player* player) const
+std::vector<Territory*> NeutralPlayerStrategy::toDefend(const Player*) const
 {
     return {};
 }
 
 // Return an empty list of territories to attack
-std::vector<Territory*> NeutralPlayerStrategy::toAttack(const Player* player) const
+std::vector<Territory*> NeutralPlayerStrategy::toAttack(const Player*) const
 {
     return {};
 }
 
 // Do nothing when called to issue order
-void NeutralPlayerStrategy::issueOrder(Player* player)
+void NeutralPlayerStrategy::issueOrder(Player*)
 {
     return;
 }
@@ -1,18 +1,23 @@
 #pragma once
 
+#include "../game_engine/GameTask.h"
 #include "../map/Map.h"
 #include "../player/Player.h"
 #include <iostream>
+#include <string>
 #include <vector>
 
+class InputChannel;
 class Player;
 
 class PlayerStrategy
 {
     public:
+        virtual ~PlayerStrategy();
         virtual std::vector<Territory*> toDefend(const Player* player) const = 0;
         virtual std::vector<Territory*> toAttack(const Player* player) const = 0;
         virtual void issueOrder(Player* player) = 0;
+        virtual GameTask issueOrderAsync(Player* player);
         virtual PlayerStrategy* clone() const = 0;
         friend std::ostream &operator<<(std::ostream &output, const PlayerStrategy &strategy);
 
@@ -33,10 +38,10 @@ class AggressivePlayerStrategy : public PlayerStrategy
         std::ostream &print_(std::ostream &output) const;
 
     private:
-        bool deployToTopTerritory_(Player* player, std::vector<Territory*> territoriesToDefend);
-        bool attackFromTopTerritory_(Player* player, Territory* attackFrom, std::vector<Territory*> territoriesToAttack);
-        bool advanceToRandomTerritory_(Player* player, std::vector<Territory*> territoriesToDefend);
-        bool playCard_(Player* player, std::vector<Territory*> territoriesToDefend);
+        bool deployToTopTerritory_(Player* player, Territory* topTerritory);
+        bool attackFromTopTerritory_(Player* player, Territory* attackFrom);
+        bool advanceToRandomTerritory_(Player* player, Territory* topTerritory);
+        bool playCard_(Player* player, Territory* topTerritory);
 };
 
 
@@ -71,11 +76,39 @@ class HumanPlayerStrategy : public PlayerStrategy
 
     private:
         void deployReinforcements_(Player* player, std::vector<Territory*> territoriesToDefend);
-        void issueAdvance_(Player* player, std::vector<Territory*> territoriesToDefend);
+        void issueAdvance_(Player* player);
         void playCard_(Player* player, std::vector<Territory*> territoriesToDefend);
 };
 
 
+// Strategy of a client playing over an InputChannel, e.g. over the network. Every turn, the client is prompted with the
+// player's reinforcements, the number of orders issued so far and one line per owned territory:
+//     territory <id> <armies> <movable armies> <adjacent territory id>...
+// and answers with one of the commands below. Invalid commands are ignored, and the client is prompted again.
+//     deploy <territory id> <armies>
+//     advance <source territory id> <destination territory id> <armies>
+//     done
+// The client can only be awaited by games played by a GameScheduler. Asked synchronously, the player is done issuing orders.
+class RemotePlayerStrategy : public PlayerStrategy
+{
+    public:
+        RemotePlayerStrategy(InputChannel* channel);
+        PlayerStrategy* clone() const;
+        std::vector<Territory*> toDefend(const Player* player) const;
+        std::vector<Territory*> toAttack(const Player* player) const;
+        void issueOrder(Player* player);
+        GameTask issueOrderAsync(Player* player);
+
+    protected:
+        std::ostream &print_(std::ostream &output) const;
+
+    private:
+        InputChannel* channel_;
+        std::string describeTurn_(const Player* player) const;
+        void runCommand_(Player* player, const std::string &command);
+};
+
+
 class NeutralPlayerStrategy : public PlayerStrategy
 {
     public: